@@ -7,6 +7,7 @@
 #include <poincare/exception_checkpoint.h>
 #include <ion/backlight.h>
 #include <poincare/preferences.h>
+#include <poincare/print_float.h>
 
 #include <algorithm>
 
@@ -152,6 +153,8 @@ bool AppsContainer::dispatchEvent(Ion::Events::Event event) {
 	  }
       if (switchTo(usbConnectedAppSnapshot())) {
         Ion::USB::DFU();
+        // The host may have written to the storage without notifying it
+        Ion::Storage::sharedStorage()->invalidateChecksum();
         // Update LED when exiting DFU mode
         Ion::LED::updateColorWithPlugAndCharge();
         bool switched = switchTo(activeSnapshot);
@@ -292,6 +295,10 @@ bool AppsContainer::switchTo(App::Snapshot * snapshot) {
 }
 
 void AppsContainer::run() {
+#if ION_SIMULATOR_FILES
+  // Restore the state of a snapshot loaded at launch, if any
+  Ion::State::setDelegate(this);
+#endif
   KDRect screenRect = KDRect(0, 0, Ion::Display::Width, Ion::Display::Height);
   window()->setFrame(screenRect, false);
   /* We push a white screen here, because fetching the exam mode takes some time
@@ -313,7 +320,13 @@ void AppsContainer::run() {
     /* Normal execution. The exception checkpoint must be created before
      * switching to the first app, because the first app might create nodes on
      * the pool. */
-    bool switched = switchTo(initialAppSnapshot());
+    App::Snapshot * initialSnapshot = initialAppSnapshot();
+#if ION_SIMULATOR_FILES
+    if (m_restoredAppSnapshot != nullptr) {
+      initialSnapshot = m_restoredAppSnapshot;
+    }
+#endif
+    bool switched = switchTo(initialSnapshot);
     assert(switched);
     (void) switched; // Silence compilation warning about unused variable.
   } else {
@@ -332,9 +345,12 @@ void AppsContainer::run() {
        * history here, we will be stuck outside the calculation app. */
       s_activeApp->snapshot()->reset();
     }
+    App::Snapshot * failedSnapshot = s_activeApp != nullptr ? s_activeApp->snapshot() : nullptr;
     bool switched = switchTo(appSnapshotAtIndex(0));
     assert(switched);
     (void) switched; // Silence compilation warning about unused variable.
+    // The data saved when leaving the app are those of the failure
+    discardWarmSnapshot(failedSnapshot);
     Poincare::Tidy();
     s_activeApp->displayWarning(I18n::Message::PoolMemoryFull1, I18n::Message::PoolMemoryFull2, true);
   }
@@ -459,6 +475,114 @@ Timer * AppsContainer::containerTimerAtIndex(int i) {
   return timers[i];
 }
 
+#if ION_SIMULATOR_FILES
+
+/* State serialized in the simulator snapshots, on top of the storage. The
+ * software version is checked when loading a snapshot, so this layout only
+ * needs to be consistent within a given build. */
+class __attribute__((packed)) SerializedState {
+public:
+  constexpr static uint8_t k_version = 1;
+  uint8_t m_version;
+  // Poincare::Preferences
+  Preferences::AngleUnit m_angleUnit;
+  Preferences::PrintFloatMode m_displayMode;
+  Preferences::EditionMode m_editionMode;
+  Preferences::ComplexFormat m_complexFormat;
+  uint8_t m_numberOfSignificantDigits;
+  Preferences::SymbolMultiplication m_symbolMultiplication;
+  Preferences::SymbolFunction m_symbolFunction;
+  Preferences::PythonFont m_pythonFont;
+  // GlobalPreferences
+  I18n::Language m_language;
+  I18n::Country m_country;
+  bool m_showPopUp;
+  int m_brightnessLevel;
+  bool m_largeFont;
+  // Active app
+  int8_t m_activeAppIndex;
+  /* A snapshot can be corrupted or edited by hand, so every field is checked
+   * before being handed to the preferences. */
+  bool isValid() const {
+    return m_version == k_version
+      && static_cast<uint8_t>(m_angleUnit) <= static_cast<uint8_t>(Preferences::AngleUnit::Gradian)
+      && static_cast<uint8_t>(m_displayMode) <= static_cast<uint8_t>(Preferences::PrintFloatMode::Engineering)
+      && (m_editionMode == Preferences::EditionMode::Edition2D || m_editionMode == Preferences::EditionMode::Edition1D)
+      && static_cast<uint8_t>(m_complexFormat) <= static_cast<uint8_t>(Preferences::ComplexFormat::Polar)
+      && m_numberOfSignificantDigits >= 1 && m_numberOfSignificantDigits <= PrintFloat::k_numberOfStoredSignificantDigits
+      && static_cast<uint8_t>(m_symbolMultiplication) <= static_cast<uint8_t>(Preferences::SymbolMultiplication::Auto)
+      && static_cast<uint8_t>(m_symbolFunction) <= static_cast<uint8_t>(Preferences::SymbolFunction::Arg)
+      && static_cast<uint8_t>(m_pythonFont) <= static_cast<uint8_t>(Preferences::PythonFont::Small)
+      && static_cast<int>(m_language) < I18n::NumberOfLanguages
+      && static_cast<int>(m_country) < I18n::NumberOfCountries
+      && m_brightnessLevel >= 0 && m_brightnessLevel <= Ion::Backlight::MaxBrightness;
+  }
+};
+
+int AppsContainer::serializeState(char * buffer, int bufferSize) {
+  if (bufferSize < static_cast<int>(sizeof(SerializedState))) {
+    return -1;
+  }
+  SerializedState state;
+  state.m_version = SerializedState::k_version;
+  Preferences * preferences = Preferences::sharedPreferences();
+  state.m_angleUnit = preferences->angleUnit();
+  state.m_displayMode = preferences->displayMode();
+  state.m_editionMode = preferences->editionMode();
+  state.m_complexFormat = preferences->complexFormat();
+  state.m_numberOfSignificantDigits = preferences->numberOfSignificantDigits();
+  state.m_symbolMultiplication = preferences->symbolOfMultiplication();
+  state.m_symbolFunction = preferences->symbolOfFunction();
+  state.m_pythonFont = preferences->pythonFont();
+  GlobalPreferences * globalPreferences = GlobalPreferences::sharedGlobalPreferences();
+  state.m_language = globalPreferences->language();
+  state.m_country = globalPreferences->country();
+  state.m_showPopUp = globalPreferences->showPopUp();
+  state.m_brightnessLevel = globalPreferences->brightnessLevel();
+  state.m_largeFont = globalPreferences->font() == KDFont::LargeFont;
+  state.m_activeAppIndex = -1;
+  for (int i = 0; i < numberOfApps(); i++) {
+    if (s_activeApp != nullptr && appSnapshotAtIndex(i) == s_activeApp->snapshot()) {
+      state.m_activeAppIndex = i;
+      break;
+    }
+  }
+  memcpy(buffer, &state, sizeof(SerializedState));
+  return sizeof(SerializedState);
+}
+
+bool AppsContainer::restoreState(const char * buffer, int bufferSize) {
+  SerializedState state;
+  if (bufferSize != static_cast<int>(sizeof(SerializedState))) {
+    return false;
+  }
+  memcpy(&state, buffer, sizeof(SerializedState));
+  if (!state.isValid()) {
+    return false;
+  }
+  Preferences * preferences = Preferences::sharedPreferences();
+  preferences->setAngleUnit(state.m_angleUnit);
+  preferences->setDisplayMode(state.m_displayMode);
+  preferences->setEditionMode(state.m_editionMode);
+  preferences->setComplexFormat(state.m_complexFormat);
+  preferences->setNumberOfSignificantDigits(state.m_numberOfSignificantDigits);
+  preferences->setSymbolMultiplication(state.m_symbolMultiplication);
+  preferences->setSymbolOfFunction(state.m_symbolFunction);
+  preferences->setPythonFont(state.m_pythonFont);
+  GlobalPreferences * globalPreferences = GlobalPreferences::sharedGlobalPreferences();
+  globalPreferences->setLanguage(state.m_language);
+  globalPreferences->setCountry(state.m_country);
+  globalPreferences->setShowPopUp(state.m_showPopUp);
+  globalPreferences->setBrightnessLevel(state.m_brightnessLevel);
+  globalPreferences->setFont(state.m_largeFont ? KDFont::LargeFont : KDFont::SmallFont);
+  if (state.m_activeAppIndex >= 0 && state.m_activeAppIndex < numberOfApps()) {
+    m_restoredAppSnapshot = appSnapshotAtIndex(state.m_activeAppIndex);
+  }
+  return true;
+}
+
+#endif
+
 void AppsContainer::resetShiftAlphaStatus() {
   Ion::Events::setShiftAlphaStatus(Ion::Events::ShiftAlphaStatus::Default);
   updateAlphaLock();
@@ -21,7 +21,11 @@
 
 #include <ion/events.h>
 
-class AppsContainer : public Container, ExamPopUpControllerDelegate, Ion::StorageDelegate {
+class AppsContainer : public Container, ExamPopUpControllerDelegate, Ion::StorageDelegate
+#if ION_SIMULATOR_FILES
+  , Ion::State::Delegate
+#endif
+{
 public:
   static AppsContainer * sharedAppsContainer();
   AppsContainer();
@@ -55,6 +59,11 @@ public:
   // Ion::StorageDelegate
   void storageDidChangeForRecord(const Ion::Storage::Record record) override;
   void storageIsFull() override;
+#if ION_SIMULATOR_FILES
+  // Ion::State::Delegate
+  int serializeState(char * buffer, int bufferSize) override;
+  bool restoreState(const char * buffer, int bufferSize) override;
+#endif
 protected:
   Home::App::Snapshot * homeAppSnapshot() { return &m_homeSnapshot; }
 private:
@@ -83,6 +92,9 @@ private:
   OnBoarding::App::Snapshot m_onBoardingSnapshot;
   HardwareTest::App::Snapshot m_hardwareTestSnapshot;
   USB::App::Snapshot m_usbConnectedSnapshot;
+#if ION_SIMULATOR_FILES
+  App::Snapshot * m_restoredAppSnapshot = nullptr;
+#endif
 };
 
 #endif
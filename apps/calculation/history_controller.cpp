@@ -12,6 +12,8 @@ HistoryController::HistoryController(EditExpressionController * editExpressionCo
   ViewController(editExpressionController),
   m_selectableTableView(this, this, this, this),
   m_calculationHistory{},
+  m_rowHeightIndex(),
+  m_rowHeightIndexExpandedRow(-1),
   m_calculationStore(calculationStore),
   m_complexController(editExpressionController),
   m_integerController(editExpressionController),
@@ -33,6 +35,8 @@ void HistoryController::reload() {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].resetMemoization();
   }
+  // Calculations might have been added or deleted
+  m_rowHeightIndex.invalidate();
 
   m_selectableTableView.reloadData();
   /* TODO
@@ -212,6 +216,34 @@ KDCoordinate HistoryController::rowHeight(int j) {
   return calculation->height(expanded);
 }
 
+KDCoordinate HistoryController::cumulatedHeightFromIndex(int j) {
+  updateRowHeightIndex();
+  return m_rowHeightIndex.cumulatedHeightFromIndex(this, j);
+}
+
+int HistoryController::indexFromCumulatedHeight(KDCoordinate offsetY) {
+  updateRowHeightIndex();
+  return m_rowHeightIndex.indexFromCumulatedHeight(this, offsetY);
+}
+
+int HistoryController::expandedRow() {
+  return selectedSubviewType() == SubviewType::Output ? selectedRow() : -1;
+}
+
+void HistoryController::updateRowHeightIndex() {
+  /* Only the heights of the previously and currently expanded rows changed
+   * since the index was computed. */
+  int row = expandedRow();
+  if (row != m_rowHeightIndexExpandedRow) {
+    if (row < 0 || (m_rowHeightIndexExpandedRow >= 0 && m_rowHeightIndexExpandedRow < row)) {
+      m_rowHeightIndex.invalidateFromRow(m_rowHeightIndexExpandedRow);
+    } else {
+      m_rowHeightIndex.invalidateFromRow(row);
+    }
+    m_rowHeightIndexExpandedRow = row;
+  }
+}
+
 int HistoryController::typeAtLocation(int i, int j) {
   return 0;
 }
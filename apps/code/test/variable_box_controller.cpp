@@ -68,3 +68,15 @@ QUIZ_CASE(variable_box_controller) {
       expectedVariables,
       sizeof(expectedVariables) / sizeof(const char *));
 }
+
+QUIZ_CASE(variable_box_controller_builtins) {
+  const char * expectedVariables[] = {
+    "pop()",
+    "pow()"
+  };
+  assert_variables_are(
+      "\x01 a=1",
+      "po",
+      expectedVariables,
+      sizeof(expectedVariables) / sizeof(const char *));
+}
@@ -480,8 +480,8 @@ void VariableBoxController::loadBuiltinNodes(const char * textToAutocomplete, in
     {"or", ScriptNode::Type::WithoutParentheses},
     {qstr_str(MP_QSTR_ord), ScriptNode::Type::WithParentheses},
     {"pass", ScriptNode::Type::WithoutParentheses},
-    {qstr_str(MP_QSTR_pow), ScriptNode::Type::WithParentheses},
     {qstr_str(MP_QSTR_pop), ScriptNode::Type::WithParentheses},
+    {qstr_str(MP_QSTR_pow), ScriptNode::Type::WithParentheses},
     {qstr_str(MP_QSTR_print), ScriptNode::Type::WithParentheses},
     //{qstr_str(MP_QSTR_property), ScriptNode::Type::WithParentheses},
     {"raise", ScriptNode::Type::WithoutParentheses},
@@ -514,7 +514,21 @@ void VariableBoxController::loadBuiltinNodes(const char * textToAutocomplete, in
     {qstr_str(MP_QSTR_zip), ScriptNode::Type::WithParentheses}
   };
   assert(sizeof(builtinNames) / sizeof(builtinNames[0]) == k_totalBuiltinNodesCount);
-  for (int i = 0; i < k_totalBuiltinNodesCount; i++) {
+  int firstIndex = 0;
+  if (textToAutocomplete != nullptr) {
+    /* Builtin nodes are stored in alphabetical order: find by binary search
+     * the first one that is not before the text to autocomplete. */
+    int lastIndex = k_totalBuiltinNodesCount;
+    while (firstIndex < lastIndex) {
+      int middleIndex = (firstIndex + lastIndex) / 2;
+      if (strncmp(builtinNames[middleIndex].name, textToAutocomplete, textToAutocompleteLength) < 0) {
+        firstIndex = middleIndex + 1;
+      } else {
+        lastIndex = middleIndex;
+      }
+    }
+  }
+  for (int i = firstIndex; i < k_totalBuiltinNodesCount; i++) {
     if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, builtinNames[i].type, NodeOrigin::Builtins, builtinNames[i].name)) {
       /* We can leverage on the fact that buitin nodes are stored in
        * alphabetical order. */
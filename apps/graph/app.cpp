@@ -2,6 +2,7 @@
 #include "../apps_container.h"
 #include "graph_icon.h"
 #include <apps/i18n.h>
+#include <string.h>
 
 using namespace Poincare;
 using namespace Shared;
@@ -47,6 +48,34 @@ App::Descriptor * App::Snapshot::descriptor() {
   return &descriptor;
 }
 
+size_t App::Snapshot::saveWarmState(void * buffer, size_t bufferSize) {
+  if (bufferSize < sizeof(WarmStateHeader)) {
+    return 0;
+  }
+  WarmStateHeader header = warmStateHeader();
+  memcpy(buffer, &header, sizeof(WarmStateHeader));
+  return sizeof(WarmStateHeader) + m_functionStore.saveWarmState(static_cast<char *>(buffer) + sizeof(WarmStateHeader), bufferSize - sizeof(WarmStateHeader));
+}
+
+bool App::Snapshot::restoreWarmState(const void * buffer, size_t size) {
+  WarmStateHeader header = warmStateHeader();
+  if (size < sizeof(WarmStateHeader) || memcmp(buffer, &header, sizeof(WarmStateHeader)) != 0) {
+    return false;
+  }
+  m_functionStore.restoreWarmState(static_cast<const char *>(buffer) + sizeof(WarmStateHeader), size - sizeof(WarmStateHeader));
+  return true;
+}
+
+App::Snapshot::WarmStateHeader App::Snapshot::warmStateHeader() {
+  WarmStateHeader header;
+  // Zero the padding so that headers can be compared with memcmp
+  memset(static_cast<void *>(&header), 0, sizeof(WarmStateHeader));
+  header.storageChecksum = m_functionStore.storeChecksum();
+  header.rangeChecksum = m_graphRange.rangeChecksum();
+  header.preferences = *Preferences::sharedPreferences();
+  return header;
+}
+
 void App::Snapshot::tidy() {
   m_functionStore.tidy();
   m_graphRange.setDelegate(nullptr);
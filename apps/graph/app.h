@@ -31,7 +31,17 @@ public:
     Shared::Interval * intervalForType(Shared::ContinuousFunction::PlotType plotType) {
       return m_interval + static_cast<size_t>(plotType);
     }
+    size_t saveWarmState(void * buffer, size_t bufferSize) override;
+    bool restoreWarmState(const void * buffer, size_t size) override;
   private:
+    /* The memoized functions only hold if neither the storage, the range nor
+     * the preferences changed while the app was inactive. */
+    struct WarmStateHeader {
+      uint32_t storageChecksum;
+      uint32_t rangeChecksum;
+      Poincare::Preferences preferences;
+    };
+    WarmStateHeader warmStateHeader();
     void tidy() override;
     ContinuousFunctionStore m_functionStore;
     Shared::InteractiveCurveViewRange m_graphRange;
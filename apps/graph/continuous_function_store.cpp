@@ -23,6 +23,44 @@ Ion::Storage::Record::ErrorStatus ContinuousFunctionStore::addEmptyModel() {
   return error;
 }
 
+size_t ContinuousFunctionStore::saveWarmState(void * buffer, size_t bufferSize) const {
+  char * position = static_cast<char *>(buffer);
+  char * end = position + bufferSize;
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    ContinuousFunction * f = &m_functions[i];
+    if (f->isNull() || end - position < static_cast<ptrdiff_t>(sizeof(WarmFunction))) {
+      continue;
+    }
+    WarmFunction * warmFunction = reinterpret_cast<WarmFunction *>(position);
+    char * expression = reinterpret_cast<char *>(warmFunction + 1);
+    size_t expressionSize = f->saveExpressionReduced(expression, end - expression);
+    if (expressionSize > UINT16_MAX) {
+      expressionSize = 0;
+    }
+    *warmFunction = {*f, static_cast<uint16_t>(expressionSize), static_cast<int8_t>(i), static_cast<int8_t>(f->cache() == nullptr ? -1 : f->cache() - m_functionCaches)};
+    position = expression + ((expressionSize + alignof(WarmFunction) - 1) & ~(alignof(WarmFunction) - 1));
+  }
+  return position - static_cast<char *>(buffer);
+}
+
+void ContinuousFunctionStore::restoreWarmState(const void * buffer, size_t size) {
+  const char * position = static_cast<const char *>(buffer);
+  const char * end = position + size;
+  while (position < end) {
+    const WarmFunction * warmFunction = reinterpret_cast<const WarmFunction *>(position);
+    const char * expression = reinterpret_cast<const char *>(warmFunction + 1);
+    ContinuousFunction * f = static_cast<ContinuousFunction *>(setMemoizedModelAtIndex(warmFunction->memoizationIndex, warmFunction->record));
+    if (warmFunction->expressionSize > 0) {
+      f->restoreExpressionReduced(expression, warmFunction->expressionSize);
+    }
+    if (warmFunction->cacheIndex >= 0) {
+      // The cache was filled for this function, which PrepareForCaching checks
+      f->setCache(m_functionCaches + warmFunction->cacheIndex);
+    }
+    position = expression + ((warmFunction->expressionSize + alignof(WarmFunction) - 1) & ~(alignof(WarmFunction) - 1));
+  }
+}
+
 ExpressionModelHandle * ContinuousFunctionStore::setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const {
   assert(cacheIndex >= 0 && cacheIndex < maxNumberOfMemoizedModels());
   m_functions[cacheIndex] = ContinuousFunction(record);
@@ -18,7 +18,18 @@ public:
   Shared::ExpiringPointer<Shared::ContinuousFunction> modelForRecord(Ion::Storage::Record record) const { return Shared::ExpiringPointer<Shared::ContinuousFunction>(static_cast<Shared::ContinuousFunction *>(privateModelForRecord(record))); }
   Shared::ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < Shared::ContinuousFunctionCache::k_numberOfAvailableCaches) ? m_functionCaches + i : nullptr; }
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
+  /* The memoized functions, their reduced expressions and the caches they use
+   * can be saved before the store is tidied and restored afterwards, provided
+   * that the storage did not change meanwhile. */
+  size_t saveWarmState(void * buffer, size_t bufferSize) const;
+  void restoreWarmState(const void * buffer, size_t size);
 private:
+  struct WarmFunction {
+    Ion::Storage::Record record;
+    uint16_t expressionSize;
+    int8_t memoizationIndex;
+    int8_t cacheIndex;
+  };
   const char * modelExtension() const override { return Ion::Storage::funcExtension; }
   Shared::ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const override;
   Shared::ExpressionModelHandle * memoizedModelAtIndex(int cacheIndex) const override;
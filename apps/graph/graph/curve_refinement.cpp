@@ -0,0 +1,71 @@
+#include "curve_refinement.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace Graph {
+
+constexpr KDCoordinate CurveRefinement::k_coarsestPixelStep;
+constexpr KDCoordinate CurveRefinement::k_tileSize;
+
+void CurveRefinement::reset() {
+  for (int row = 0; row < k_numberOfRows; row++) {
+    for (int column = 0; column < k_numberOfColumns; column++) {
+      m_pixelSteps[row][column] = 1;
+    }
+  }
+}
+
+bool CurveRefinement::isFinished() const {
+  for (int row = 0; row < k_numberOfRows; row++) {
+    for (int column = 0; column < k_numberOfColumns; column++) {
+      if (m_pixelSteps[row][column] > 1) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void CurveRefinement::sketch(KDRect rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  int firstColumn = std::max(0, rect.left() / k_tileSize);
+  int lastColumn = std::min(k_numberOfColumns - 1, rect.right() / k_tileSize);
+  int firstRow = std::max(0, rect.top() / k_tileSize);
+  int lastRow = std::min(k_numberOfRows - 1, rect.bottom() / k_tileSize);
+  for (int row = firstRow; row <= lastRow; row++) {
+    for (int column = firstColumn; column <= lastColumn; column++) {
+      m_pixelSteps[row][column] = k_coarsestPixelStep;
+    }
+  }
+}
+
+bool CurveRefinement::nextStrip(KDRect * strip, KDCoordinate * pixelStep) {
+  uint8_t coarsestStep = 1;
+  int stripColumn = 0;
+  int stripRow = 0;
+  for (int column = 0; column < k_numberOfColumns; column++) {
+    for (int row = 0; row < k_numberOfRows; row++) {
+      if (m_pixelSteps[row][column] > coarsestStep) {
+        coarsestStep = m_pixelSteps[row][column];
+        stripColumn = column;
+        stripRow = row;
+      }
+    }
+  }
+  if (coarsestStep == 1) {
+    return false;
+  }
+  int numberOfRows = 0;
+  while (stripRow + numberOfRows < k_numberOfRows && m_pixelSteps[stripRow + numberOfRows][stripColumn] == coarsestStep) {
+    m_pixelSteps[stripRow + numberOfRows][stripColumn] = coarsestStep / 2;
+    numberOfRows++;
+  }
+  assert(numberOfRows > 0);
+  *strip = KDRect(stripColumn * k_tileSize, stripRow * k_tileSize, k_tileSize, numberOfRows * k_tileSize);
+  *pixelStep = coarsestStep / 2;
+  return true;
+}
+
+}
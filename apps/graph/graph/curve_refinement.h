@@ -0,0 +1,36 @@
+#ifndef GRAPH_CURVE_REFINEMENT_H
+#define GRAPH_CURVE_REFINEMENT_H
+
+#include <ion/display.h>
+#include <kandinsky/rect.h>
+#include <stdint.h>
+
+namespace Graph {
+
+/* Keeps track of the pixel step at which the curves of each tile of the graph
+ * view were last drawn. Sketched areas start at the coarsest step and are
+ * refined strip by strip, the coarsest strips first, in passes that halve the
+ * step down to one pixel. Sketching a new area only restarts the tiles it
+ * covers: the passes over the rest of the view go on where they were. */
+
+class CurveRefinement {
+public:
+  constexpr static KDCoordinate k_coarsestPixelStep = 8;
+  constexpr static KDCoordinate k_tileSize = 32;
+  CurveRefinement() { reset(); }
+  void reset();
+  bool isFinished() const;
+  void sketch(KDRect rect);
+  /* Returns false if every tile is drawn at full resolution. Otherwise, sets
+   * strip to the leftmost run of vertically adjacent tiles at the coarsest
+   * step, and pixelStep to the step they should be redrawn at. */
+  bool nextStrip(KDRect * strip, KDCoordinate * pixelStep);
+private:
+  constexpr static int k_numberOfColumns = (Ion::Display::Width + k_tileSize - 1) / k_tileSize;
+  constexpr static int k_numberOfRows = (Ion::Display::Height + k_tileSize - 1) / k_tileSize;
+  uint8_t m_pixelSteps[k_numberOfRows][k_numberOfColumns];
+};
+
+}
+
+#endif
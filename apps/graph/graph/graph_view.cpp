@@ -10,7 +10,11 @@ namespace Graph {
 GraphView::GraphView(InteractiveCurveViewRange * graphRange,
   CurveViewCursor * cursor, Shared::BannerView * bannerView, CursorView * cursorView) :
   FunctionGraphView(graphRange, cursor, bannerView, cursorView),
-  m_tangent(false)
+  m_tangent(false),
+  m_curveRefinement(),
+  m_refinedStrip(KDRectZero),
+  m_refinedStripPixelStep(1),
+  m_curveRefinementTask(this)
 {
 }
 
@@ -24,6 +28,48 @@ void GraphView::reload() {
 
 void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   FunctionGraphView::drawRect(ctx, rect);
+  KDCoordinate pixelStep = 1;
+  bool isRefinedStrip = false;
+  if (rect.width() > CurveRefinement::k_tileSize && canDrawCurvesProgressively()) {
+    // Sketch the curves and refine them in later passes
+    pixelStep = CurveRefinement::k_coarsestPixelStep;
+    m_curveRefinement.sketch(rect);
+  } else if (m_refinedStrip.containsRect(rect)) {
+    pixelStep = m_refinedStripPixelStep;
+    isRefinedStrip = true;
+  }
+  m_refinedStrip = KDRectZero;
+  /* The task is scheduled again if a key press cancelled the remaining
+   * passes. */
+  bool refining = !m_curveRefinement.isFinished();
+  if (refining && !TaskScheduler::sharedScheduler()->schedule(&m_curveRefinementTask)) {
+    pixelStep = 1;
+    m_curveRefinement.reset();
+    refining = false;
+  }
+  // Anchor the cache on the view while refining so that the samples are reused
+  drawCurves(ctx, rect, pixelStep, refining || isRefinedStrip ? 0 : rect.left());
+}
+
+bool GraphView::refineNextStrip() {
+  KDRect strip = KDRectZero;
+  bool found = m_curveRefinement.nextStrip(&strip, &m_refinedStripPixelStep);
+  assert(found);
+  (void)found; // Silence compilation warning about unused variable.
+  m_refinedStrip = strip.intersectedWith(bounds());
+  markRectAsDirty(m_refinedStrip);
+  return true;
+}
+
+bool GraphView::canDrawCurvesProgressively() const {
+  /* Only cartesian curves can be refined strip by strip: the other curves are
+   * sampled over their whole parameter range whatever the drawn area. */
+  ContinuousFunctionStore * functionStore = App::app()->functionStore();
+  int numberOfActiveFunctions = functionStore->numberOfActiveFunctions();
+  return numberOfActiveFunctions > 0 && numberOfActiveFunctions == functionStore->numberOfActiveFunctionsOfType(ContinuousFunction::PlotType::Cartesian);
+}
+
+void GraphView::drawCurves(KDContext * ctx, KDRect rect, KDCoordinate pixelStep, KDCoordinate cacheLeft) const {
   ContinuousFunctionStore * functionStore = App::app()->functionStore();
   const int activeFunctionsCount = functionStore->numberOfActiveFunctions();
   for (int i = 0; i < activeFunctionsCount ; i++) {
@@ -43,7 +89,7 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
 
     float tCacheMin, tCacheStep, tStepNonCartesian;
     if (type == ContinuousFunction::PlotType::Cartesian) {
-      float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
+      float rectLeft = pixelToFloat(Axis::Horizontal, cacheLeft - k_externRectMargin);
       /* Here, tCacheMin can depend on rect (and change as the user move)
        * because cache can be panned for cartesian curves, instead of being
        * entirely invalidated. */
@@ -67,6 +113,11 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
             ContinuousFunction * f = (ContinuousFunction *)model;
             Poincare::Context * c = (Poincare::Context *)context;
             return f->evaluateXYAtParameter(t, c);
+          }, pixelStep,
+          [](float xMin, float xMax, void * model, void * context) {
+            ContinuousFunction * f = (ContinuousFunction *)model;
+            Poincare::Context * c = (Poincare::Context *)context;
+            return f->evaluateYIntervalBetween(xMin, xMax, c);
           });
       /* Draw tangent */
       if (m_tangent && record == m_selectedRecord) {
@@ -1,6 +1,7 @@
 #ifndef GRAPH_GRAPH_VIEW_H
 #define GRAPH_GRAPH_VIEW_H
 
+#include "curve_refinement.h"
 #include "../../shared/function_graph_view.h"
 
 namespace Graph {
@@ -31,7 +32,27 @@ public:
    * of the graph where the area under the curve is colored. */
   void setAreaHighlightColor(bool highlightColor) override {};
 private:
+  /* When a large area is redrawn, the curves are first sketched by sampling
+   * every CurveRefinement::k_coarsestPixelStep-th column. A task then redraws
+   * the sketched tiles strip by strip until they reach full resolution. While
+   * refining, the function caches are anchored on the left of the view, so
+   * each pass only evaluates the new columns. */
+  class CurveRefinementTask : public Task {
+  public:
+    CurveRefinementTask(GraphView * graphView) : Task(Priority::Low), m_graphView(graphView) {}
+    bool step() override { return m_graphView->refineNextStrip(); }
+    bool isFinished() const override { return m_graphView->m_curveRefinement.isFinished(); }
+  private:
+    GraphView * m_graphView;
+  };
+  bool refineNextStrip();
+  void drawCurves(KDContext * ctx, KDRect rect, KDCoordinate pixelStep, KDCoordinate cacheLeft) const;
+  bool canDrawCurvesProgressively() const;
   bool m_tangent;
+  mutable CurveRefinement m_curveRefinement;
+  mutable KDRect m_refinedStrip;
+  mutable KDCoordinate m_refinedStripPixelStep;
+  mutable CurveRefinementTask m_curveRefinementTask;
 };
 
 }
@@ -121,4 +121,105 @@ QUIZ_CASE(graph_caching) {
   assert_cache_stays_valid(Polar, "cos(5θ)", -1e8f, 1e8f);
 }
 
+void assign_variable(const char * definition, ContinuousFunctionStore * store, Context * context) {
+  Expression::ParseAndSimplify(definition, context, Preferences::sharedPreferences()->complexFormat(), Preferences::sharedPreferences()->angleUnit(), Preferences::UnitFormat::Metric);
+  store->storageDidChangeForRecord(Ion::Storage::sharedStorage()->recordBaseNamedWithExtension("a", Ion::Storage::expExtension));
+}
+
+QUIZ_CASE(graph_memoization_after_storage_change) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  assign_variable("2→a", &functionStore, &globalContext);
+
+  Ion::Storage::Record dependent = *addFunction("a×x", Cartesian, &functionStore, &globalContext);
+  Ion::Storage::Record independent = *addFunction("x^2", Cartesian, &functionStore, &globalContext);
+  quiz_assert(functionStore.modelForRecord(dependent)->evaluateXYAtParameter(3.f, &globalContext).x2() == 6.f);
+  ContinuousFunction * independentFunction = static_cast<ContinuousFunction *>(functionStore.modelForRecord(independent).operator->());
+  uint16_t reducedIdentifier = independentFunction->expressionReduced(&globalContext).identifier();
+
+  assign_variable("3→a", &functionStore, &globalContext);
+  // The function depending on a is reduced again
+  quiz_assert(functionStore.modelForRecord(dependent)->evaluateXYAtParameter(3.f, &globalContext).x2() == 9.f);
+  // The other function keeps its memoized reduction
+  quiz_assert(functionStore.modelForRecord(independent).operator->() == independentFunction);
+  quiz_assert(independentFunction->expressionReduced(&globalContext).identifier() == reducedIdentifier);
+
+  functionStore.removeAll();
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("a", Ion::Storage::expExtension);
+}
+
+float cached_polar_abscissa(Ion::Storage::Record record, ContinuousFunctionStore * store, Context * context, float tCacheStep, float t) {
+  ContinuousFunction * function = store->modelForRecord(record).operator->();
+  ContinuousFunctionCache::PrepareForCaching(function, store->cacheAtIndex(0), function->tMin(), tCacheStep);
+  return function->evaluateXYAtParameter(t, context).x1();
+}
+
+QUIZ_CASE(graph_cache_validity) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  assign_variable("2→a", &functionStore, &globalContext);
+  // random() tells whether a value comes from the cache
+  Ion::Storage::Record record = *addFunction("a×θ+random()", Polar, &functionStore, &globalContext);
+  ContinuousFunction * function = functionStore.modelForRecord(record).operator->();
+  const float tMin = function->tMin();
+  float tStep, tCacheStep;
+  ContinuousFunctionCache::ComputeNonCartesianSteps(&tStep, &tCacheStep, function->tMax(), tMin);
+  const float t = tMin + 3.f * tCacheStep;
+  float cachedValue = cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, t);
+
+  // The cache survives the function being memoized again
+  functionStore.tidy();
+  quiz_assert(cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, t) == cachedValue);
+  // Deeper recursion steps are cached as well
+  const float deepT = tMin + 7.f * tStep / 64.f;
+  float deepValue = cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, deepT);
+  bool deepStepsAreCached = cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, deepT) == deepValue;
+#if PLATFORM_DEVICE
+  quiz_assert(!deepStepsAreCached);
+#else
+  quiz_assert(deepStepsAreCached);
+#endif
+
+  // It is cleared when a record the function depends on changes
+  assign_variable("3→a", &functionStore, &globalContext);
+  quiz_assert(cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, t) != cachedValue);
+  cachedValue = cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, t);
+
+  // And when the preferences change
+  Preferences::AngleUnit angleUnit = Preferences::sharedPreferences()->angleUnit();
+  Preferences::sharedPreferences()->setAngleUnit(angleUnit == Preferences::AngleUnit::Radian ? Preferences::AngleUnit::Degree : Preferences::AngleUnit::Radian);
+  quiz_assert(cached_polar_abscissa(record, &functionStore, &globalContext, tCacheStep, t) != cachedValue);
+  Preferences::sharedPreferences()->setAngleUnit(angleUnit);
+
+  functionStore.removeAll();
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("a", Ion::Storage::expExtension);
+}
+
+QUIZ_CASE(graph_warm_state) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunction * function = addFunction("sin(x)", Cartesian, &functionStore, &globalContext);
+  ContinuousFunctionCache * cache = functionStore.cacheAtIndex(0);
+  constexpr float tMin = -5.f;
+  constexpr float tStep = 10.f / (Ion::Display::Width - 1);
+  ContinuousFunctionCache::PrepareForCaching(function, cache, tMin, tStep);
+  float cachedValue = function->evaluateXYAtParameter(tMin + 10 * tStep, &globalContext).x2();
+  Expression reduced = function->expressionReduced(&globalContext);
+
+  char buffer[256];
+  size_t size = functionStore.saveWarmState(buffer, sizeof(buffer));
+  quiz_assert(size > 0);
+  functionStore.tidy();
+  quiz_assert(function->cache() == nullptr);
+
+  functionStore.restoreWarmState(buffer, size);
+  // The function is memoized again with its reduced expression and its cache
+  quiz_assert(function->cache() == cache);
+  quiz_assert(function->expressionReduced(&globalContext).isIdenticalTo(reduced));
+  ContinuousFunctionCache::PrepareForCaching(function, cache, tMin, tStep);
+  quiz_assert(function->evaluateXYAtParameter(tMin + 10 * tStep, &globalContext).x2() == cachedValue);
+
+  functionStore.removeAll();
+}
+
 }
@@ -0,0 +1,76 @@
+#include <quiz.h>
+#include "../graph/curve_refinement.h"
+
+namespace Graph {
+
+constexpr KDCoordinate k_tile = CurveRefinement::k_tileSize;
+constexpr KDCoordinate k_viewHeight = 6 * k_tile;
+
+void assert_next_strip_is(CurveRefinement * refinement, KDRect expectedStrip, KDCoordinate expectedPixelStep) {
+  KDRect strip = KDRectZero;
+  KDCoordinate pixelStep = 0;
+  quiz_assert(refinement->nextStrip(&strip, &pixelStep));
+  quiz_assert(strip == expectedStrip);
+  quiz_assert(pixelStep == expectedPixelStep);
+}
+
+void assert_pass_over_columns(CurveRefinement * refinement, int firstColumn, int lastColumn, KDCoordinate pixelStep) {
+  for (int column = firstColumn; column <= lastColumn; column++) {
+    assert_next_strip_is(refinement, KDRect(column * k_tile, 0, k_tile, k_viewHeight), pixelStep);
+  }
+}
+
+void assert_refinement_is_finished(CurveRefinement * refinement) {
+  KDRect strip = KDRectZero;
+  KDCoordinate pixelStep = 0;
+  quiz_assert(refinement->isFinished());
+  quiz_assert(!refinement->nextStrip(&strip, &pixelStep));
+}
+
+QUIZ_CASE(graph_curve_refinement_passes) {
+  CurveRefinement refinement;
+  assert_refinement_is_finished(&refinement);
+
+  refinement.sketch(KDRect(0, 0, Ion::Display::Width, k_viewHeight));
+  quiz_assert(!refinement.isFinished());
+  assert_pass_over_columns(&refinement, 0, 9, 4);
+  assert_pass_over_columns(&refinement, 0, 9, 2);
+  assert_pass_over_columns(&refinement, 0, 9, 1);
+  assert_refinement_is_finished(&refinement);
+}
+
+QUIZ_CASE(graph_curve_refinement_only_restarts_new_area) {
+  CurveRefinement refinement;
+  refinement.sketch(KDRect(0, 0, Ion::Display::Width, k_viewHeight));
+  assert_pass_over_columns(&refinement, 0, 4, 4);
+
+  /* Sketching the right of the view again does not bring the strips that are
+   * already refined back to the coarsest step. */
+  refinement.sketch(KDRect(7 * k_tile, 0, 3 * k_tile, k_viewHeight));
+  assert_pass_over_columns(&refinement, 5, 9, 4);
+  assert_pass_over_columns(&refinement, 0, 9, 2);
+
+  // A new area sketched during the last pass is refined from the start
+  assert_pass_over_columns(&refinement, 0, 2, 1);
+  refinement.sketch(KDRect(2 * k_tile + 5, 0, 20, k_viewHeight));
+  assert_pass_over_columns(&refinement, 2, 2, 4);
+  assert_pass_over_columns(&refinement, 2, 2, 2);
+  assert_pass_over_columns(&refinement, 2, 9, 1);
+  assert_refinement_is_finished(&refinement);
+}
+
+QUIZ_CASE(graph_curve_refinement_partial_area) {
+  CurveRefinement refinement;
+  refinement.sketch(KDRect(40, 70, 60, 40));
+  for (KDCoordinate pixelStep = 4; pixelStep >= 1; pixelStep /= 2) {
+    for (int column = 1; column <= 3; column++) {
+      assert_next_strip_is(&refinement, KDRect(column * k_tile, 2 * k_tile, k_tile, 2 * k_tile), pixelStep);
+    }
+  }
+  assert_refinement_is_finished(&refinement);
+
+  refinement.sketch(KDRectZero);
+  assert_refinement_is_finished(&refinement);
+}
+
+}
@@ -0,0 +1,36 @@
+#include <quiz.h>
+#include "helper.h"
+#include <cmath>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+void assert_derivative_is(const char * definition, double x, double expected) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  ContinuousFunction * function = addFunction(definition, Cartesian, &functionStore, &globalContext);
+  double derivative = function->approximateDerivative(x, &globalContext);
+  quiz_assert((std::isnan(expected) && std::isnan(derivative)) || IsApproximatelyEqual(derivative, expected, 1e-9, 0.));
+  // The derivative is computed once and served from the model afterwards
+  quiz_assert(function->approximateDerivative(x, &globalContext) == derivative);
+  functionStore.removeAll();
+}
+
+QUIZ_CASE(graph_derivative) {
+  Preferences::AngleUnit previousAngleUnit = Preferences::sharedPreferences()->angleUnit();
+  Preferences::sharedPreferences()->setAngleUnit(Preferences::AngleUnit::Radian);
+  assert_derivative_is("x^2", 3., 6.);
+  assert_derivative_is("3x^3-2x", -1., 7.);
+  assert_derivative_is("sin(x)", 0., 1.);
+  assert_derivative_is("ℯ^(2x)", 0., 2.);
+  assert_derivative_is("ln(x)", 2., 0.5);
+  assert_derivative_is("1/x", 2., -0.25);
+  // Functions without symbolic derivative fall back on the numerical method
+  assert_derivative_is("abs(x)", 2., 1.);
+  assert_derivative_is("abs(x)", -2., -1.);
+  Preferences::sharedPreferences()->setAngleUnit(previousAngleUnit);
+}
+
+}
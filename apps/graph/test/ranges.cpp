@@ -125,6 +125,41 @@ QUIZ_CASE(graph_ranges_several_functions) {
   }
 }
 
+void assert_range_is(InteractiveCurveViewRange * range, float targetXMin, float targetXMax, float targetYMin, float targetYMax) {
+  quiz_assert(float_equal(range->xMin(), targetXMin) && float_equal(range->xMax(), targetXMax) && float_equal(range->yMin(), targetYMin) && float_equal(range->yMax(), targetYMax));
+}
+
+QUIZ_CASE(graph_ranges_after_edition) {
+  /* The range of each function is memoized between two computations : check
+   * that it follows the edition of the function and of the preferences. */
+  Preferences::sharedPreferences()->setAngleUnit(Radian);
+  AdHocGraphController graphController;
+  InteractiveCurveViewRange graphRange(&graphController);
+  ContinuousFunctionStore * store = graphController.functionStore();
+  Context * context = graphController.context();
+
+  addFunction("x^2", Cartesian, store, context);
+  Ion::Storage::Record record = store->recordAtIndex(0);
+  graphRange.setDefault();
+  assert_range_is(&graphRange, -10, 10, -1.31249952, 9.3125);
+  graphRange.setDefault();
+  assert_range_is(&graphRange, -10, 10, -1.31249952, 9.3125);
+
+  store->modelForRecord(record)->setContent("x+1", context);
+  graphRange.setDefault();
+  assert_range_is(&graphRange, -12, 10, -6.19374943, 5.49374962);
+
+  store->modelForRecord(record)->setContent("cos(x)", context);
+  graphRange.setDefault();
+  float radianXMin = graphRange.xMin();
+  Preferences::sharedPreferences()->setAngleUnit(Degree);
+  graphRange.setDefault();
+  quiz_assert(graphRange.xMin() < 10.f * radianXMin);
+  Preferences::sharedPreferences()->setAngleUnit(Radian);
+
+  store->removeAll();
+}
+
 void assert_zooms_to(float xMin, float xMax, float yMin, float yMax, float targetXMin, float targetXMax, float targetYMin, float targetYMax, bool conserveRatio, bool zoomIn) {
   float ratio = zoomIn ? 1.f / ZoomCurveViewController::k_zoomOutRatio : ZoomCurveViewController::k_zoomOutRatio;
 
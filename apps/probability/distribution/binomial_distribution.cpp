@@ -61,6 +61,13 @@ bool BinomialDistribution::authorizedValueAtIndex(float x, int index) const {
   return (x >= 0.0f) && (x <= 1.0f);
 }
 
+double BinomialDistribution::cumulativeDistributiveFunctionAtAbscissa(double x) const {
+  if (m_parameter1 == 0.0 && (m_parameter2 == 0.0 || m_parameter2 == 1.0)) {
+    return NAN;
+  }
+  return Poincare::BinomialDistribution::CumulativeDistributiveFunctionAtAbscissa<double>(std::round(x), m_parameter1, m_parameter2);
+}
+
 double BinomialDistribution::cumulativeDistributiveInverseForProbability(double * probability) {
   return Poincare::BinomialDistribution::CumulativeDistributiveInverseForProbability<double>(*probability, m_parameter1, m_parameter2);
 }
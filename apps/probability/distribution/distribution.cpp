@@ -36,17 +36,27 @@ double Distribution::finiteIntegralBetweenAbscissas(double a, double b) const {
   }
   int start = std::round(a);
   int end = std::round(b);
-  double result = 0.0;
-  for (int k = start; k <=end; k++) {
-    result += evaluateAtDiscreteAbscissa(k);
-    /* Avoid too long loop */
-    if (k-start > k_maxNumberOfOperations) {
-      break;
-    }
-    if (result >= k_maxProbability) {
-      result = 1.0;
+  double result = cumulativeDistributiveFunctionAtAbscissa(end) - cumulativeDistributiveFunctionAtAbscissa(start - 1);
+  if (!(result < 1.0 - k_maxProbability)) {
+    return result;
+  }
+  /* The interval lies in a tail of the distribution, where the difference of
+   * two close cumulative values loses most of its significant digits. Sum the
+   * terms instead, from the bound closest to the mode, until they become
+   * negligible. */
+  bool fromStart = evaluateAtDiscreteAbscissa(start) >= evaluateAtDiscreteAbscissa(end);
+  result = 0.0;
+  double previousTerm = INFINITY;
+  for (int i = 0; i <= end - start; i++) {
+    double term = evaluateAtDiscreteAbscissa(fromStart ? start + i : end - i);
+    result += term;
+    /* Avoid too long loop. Once the terms decrease, the mode has been passed
+     * and the next terms are smaller still. They are negligible, or all null
+     * when the whole tail underflows. */
+    if (i > k_maxNumberOfOperations || (term <= previousTerm && term <= DBL_EPSILON * result)) {
       break;
     }
+    previousTerm = term;
   }
   return result;
 }
@@ -61,10 +71,10 @@ double Distribution::cumulativeDistributiveInverseForProbability(double * probab
   if (*probability < DBL_EPSILON) {
     return -1.0;
   }
-  return Poincare::Solver::CumulativeDistributiveInverseForNDefinedFunction<double>(probability,
+  return Poincare::Solver::CumulativeDistributiveInverseForNDefinedCumulativeFunction<double>(probability,
         [](double k, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
         const Distribution * distribution = reinterpret_cast<const Distribution *>(context1);
-        return distribution->evaluateAtDiscreteAbscissa(k);
+        return distribution->cumulativeDistributiveFunctionAtAbscissa(k);
       }, nullptr, Poincare::Preferences::ComplexFormat::Real, Poincare::Preferences::AngleUnit::Degree, this);
     // Context, complex format and angle unit are dummy values
 }
@@ -80,26 +90,25 @@ double Distribution::rightIntegralInverseForProbability(double * probability) {
   if (*probability <= 0.0) {
     return INFINITY;
   }
-  double p = 0.0;
-  int k = 0;
-  double delta = 0.0;
-  do {
-    delta = std::fabs(1.0-*probability-p);
-    p += evaluateAtDiscreteAbscissa(k++);
-    if (p >= k_maxProbability && std::fabs(1.0-*probability-p) <= delta) {
-      *probability = 0.0;
-      return k;
-    }
-  } while (std::fabs(1.0-*probability-p) <= delta && k < k_maxNumberOfOperations);
-  if (k == k_maxNumberOfOperations) {
-    *probability = 1.0;
+  /* The result is the abscissa following the one whose cumulative value is
+   * the closest to 1-probability. */
+  double complementaryProbability = 1.0 - *probability;
+  if (complementaryProbability < DBL_EPSILON) {
+    return 0.0;
+  }
+  if (complementaryProbability > 1.0 - DBL_EPSILON) {
     return INFINITY;
   }
-  *probability = 1.0 - (p - evaluateAtDiscreteAbscissa(k-1));
-  if (std::isnan(*probability)) {
+  double k = Distribution::cumulativeDistributiveInverseForProbability(&complementaryProbability);
+  if (std::isnan(k) || std::isnan(complementaryProbability)) {
     return NAN;
   }
-  return k-1.0;
+  if (std::isinf(k)) {
+    *probability = 1.0;
+    return INFINITY;
+  }
+  *probability = 1.0 - complementaryProbability;
+  return k + 1.0;
 }
 
 double Distribution::evaluateAtDiscreteAbscissa(int k) const {
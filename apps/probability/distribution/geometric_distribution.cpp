@@ -27,6 +27,18 @@ bool GeometricDistribution::authorizedValueAtIndex(float x, int index) const {
   return true;
 }
 
+double GeometricDistribution::cumulativeDistributiveFunctionAtAbscissa(double x) const {
+  double k = std::round(x);
+  if (k < 1.0) {
+    return 0.0;
+  }
+  if (m_parameter1 == 1.0) {
+    return 1.0;
+  }
+  // The result is 1 - (1-p)^k
+  return -std::expm1(k * std::log1p(-m_parameter1));
+}
+
 template<typename T>
 T GeometricDistribution::templatedApproximateAtAbscissa(T k) const {
   constexpr T castedOne = static_cast<T>(1.0);
@@ -30,6 +30,7 @@ public:
     return templatedApproximateAtAbscissa<float>(x);
   }
   bool authorizedValueAtIndex(float x, int index) const override;
+  double cumulativeDistributiveFunctionAtAbscissa(double x) const override;
   double defaultComputedValue() const override { return 1.0; }
 private:
   double evaluateAtDiscreteAbscissa(int k) const override {
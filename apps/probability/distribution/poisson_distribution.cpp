@@ -1,4 +1,5 @@
 #include "poisson_distribution.h"
+#include "regularized_gamma.h"
 #include <assert.h>
 #include <cmath>
 #include <ion.h>
@@ -31,6 +32,19 @@ bool PoissonDistribution::authorizedValueAtIndex(float x, int index) const {
   return true;
 }
 
+double PoissonDistribution::cumulativeDistributiveFunctionAtAbscissa(double x) const {
+  double k = std::round(x);
+  if (k < 0.0) {
+    return 0.0;
+  }
+  // P(X <= k) = 1 - regularizedGamma(k+1, lambda)
+  double result = 0.0;
+  if (regularizedGammaComplement(k + 1.0, m_parameter1, k_regularizedGammaPrecision, k_maxRegularizedGammaIterations, &result)) {
+    return result;
+  }
+  return Distribution::cumulativeDistributiveFunctionAtAbscissa(x);
+}
+
 template<typename T>
 T PoissonDistribution::templatedApproximateAtAbscissa(T x) const {
   if (x < 0) {
@@ -2,11 +2,15 @@
 #define PROBABILITE_POISSON_DISTRIBUTION_H
 
 #include "one_parameter_distribution.h"
+#include <float.h>
 
 namespace Probability {
 
 class PoissonDistribution final : public OneParameterDistribution {
 public:
+  static constexpr int k_maxRegularizedGammaIterations = 1000;
+  static constexpr double k_regularizedGammaPrecision = DBL_EPSILON;
+
   PoissonDistribution() : OneParameterDistribution(4.0f) {}
   I18n::Message title() override { return I18n::Message::PoissonDistribution; }
   Type type() const override { return Type::Poisson; }
@@ -26,6 +30,7 @@ public:
     return templatedApproximateAtAbscissa<float>(x);
   }
   bool authorizedValueAtIndex(float x, int index) const override;
+  double cumulativeDistributiveFunctionAtAbscissa(double x) const override;
 private:
   double evaluateAtDiscreteAbscissa(int k) const override {
     return templatedApproximateAtAbscissa<double>(static_cast<double>(k));
@@ -5,16 +5,16 @@
 #include <float.h>
 #include <assert.h>
 
-bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result) {
+static bool regularizedGammaOrComplement(double s, double x, double epsilon, int maxNumberOfIterations, bool complement, double * result) {
   // TODO Put interruption instead of maxNumberOfIterations
 
   assert(!std::isnan(s) && !std::isnan(x) && s > 0.0 && x >= 0.0);
   if (x == 0.0) {
-    *result = 0.0;
+    *result = complement ? 1.0 : 0.0;
     return true;
   }
   if (std::isinf(x)) {
-    *result = 1.0;
+    *result = complement ? 0.0 : 1.0;
     return true;
   }
   if (x >= s + 1.0) {
@@ -58,7 +58,8 @@ bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterati
     {
       return false;
     }
-    *result = 1.0 - std::exp(-x + s*std::log(x) - std::lgamma(s)) * ( 1.0 / continuedFractionValue);
+    double upperIncompleteGamma = std::exp(-x + s*std::log(x) - std::lgamma(s)) * ( 1.0 / continuedFractionValue);
+    *result = complement ? upperIncompleteGamma : 1.0 - upperIncompleteGamma;
     return true;
   }
 
@@ -76,6 +77,15 @@ bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterati
   {
     return false;
   }
-  *result = std::isinf(infiniteSeriesValue) ? 1.0 : std::exp(-x + s*std::log(x) -  std::lgamma(s)) * infiniteSeriesValue;
+  double lowerIncompleteGamma = std::isinf(infiniteSeriesValue) ? 1.0 : std::exp(-x + s*std::log(x) -  std::lgamma(s)) * infiniteSeriesValue;
+  *result = complement ? 1.0 - lowerIncompleteGamma : lowerIncompleteGamma;
   return true;
 }
+
+bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result) {
+  return regularizedGammaOrComplement(s, x, epsilon, maxNumberOfIterations, false, result);
+}
+
+bool regularizedGammaComplement(double s, double x, double epsilon, int maxNumberOfIterations, double * result) {
+  return regularizedGammaOrComplement(s, x, epsilon, maxNumberOfIterations, true, result);
+}
@@ -8,5 +8,11 @@
 
 bool regularizedGamma(double s, double x, double epsilon, int maxNumberOfIterations, double * result);
 
+/* regularizedGammaComplement(s,x) = 1 - regularizedGamma(s,x), without the
+ * loss of precision of the subtraction when regularizedGamma(s,x) is close
+ * to 1. */
+
+bool regularizedGammaComplement(double s, double x, double epsilon, int maxNumberOfIterations, double * result);
+
 #endif
 
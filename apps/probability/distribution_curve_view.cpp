@@ -1,6 +1,7 @@
 #include "distribution_curve_view.h"
 #include "distribution/normal_distribution.h"
 #include <assert.h>
+#include <cmath>
 
 using namespace Shared;
 
@@ -31,7 +32,8 @@ void DistributionCurveView::drawRect(KDContext * ctx, KDRect rect) const {
   if (m_distribution->isContinuous()) {
     drawCartesianCurve(ctx, rect, -INFINITY, INFINITY, EvaluateXYAtAbscissa, m_distribution, nullptr, Palette::ProbabilityCurve, true, true, lowerBound, upperBound);
   } else {
-    drawHistogram(ctx, rect, EvaluateAtAbscissa, m_distribution, nullptr, 0, 1, false, Palette::ProbabilityHistogramBar, Palette::ProbabilityCurve, lowerBound, upperBound+0.5f);
+    prepareHistogramCache();
+    drawHistogram(ctx, rect, EvaluateHistogramAtAbscissa, m_distribution, const_cast<DistributionCurveView *>(this), 0, 1, false, Palette::ProbabilityHistogramBar, Palette::ProbabilityCurve, lowerBound, upperBound+0.5f);
   }
 }
 
@@ -51,6 +53,40 @@ Poincare::Coordinate2D<float> DistributionCurveView::EvaluateXYAtAbscissa(float
   return Poincare::Coordinate2D<float>(abscissa, EvaluateAtAbscissa(abscissa, model, context));
 }
 
+float DistributionCurveView::EvaluateHistogramAtAbscissa(float abscissa, void * model, void * context) {
+  DistributionCurveView * view = (DistributionCurveView *)context;
+  float cacheIndex = abscissa - view->m_histogramCacheFirstAbscissa;
+  if (abscissa != std::floor(abscissa) || !(cacheIndex >= 0.0f && cacheIndex < k_histogramCacheSize)) {
+    return EvaluateAtAbscissa(abscissa, model, context);
+  }
+  int index = cacheIndex;
+  if (std::isnan(view->m_histogramCache[index])) {
+    view->m_histogramCache[index] = EvaluateAtAbscissa(abscissa, model, context);
+  }
+  return view->m_histogramCache[index];
+}
+
+void DistributionCurveView::prepareHistogramCache() const {
+  assert(m_distribution->numberOfParameter() <= 2);
+  bool parametersChanged = m_distribution->type() != m_histogramCacheDistributionType;
+  m_histogramCacheDistributionType = m_distribution->type();
+  for (int i = 0; i < m_distribution->numberOfParameter(); i++) {
+    double parameter = m_distribution->parameterValueAtIndex(i);
+    if (parameter != m_histogramCacheParameters[i]) {
+      m_histogramCacheParameters[i] = parameter;
+      parametersChanged = true;
+    }
+  }
+  int firstAbscissa = std::floor(m_distribution->xMin());
+  if (!parametersChanged && firstAbscissa == m_histogramCacheFirstAbscissa) {
+    return;
+  }
+  m_histogramCacheFirstAbscissa = firstAbscissa;
+  for (int i = 0; i < k_histogramCacheSize; i++) {
+    m_histogramCache[i] = NAN;
+  }
+}
+
 void DistributionCurveView::drawStandardNormal(KDContext * ctx, KDRect rect, float colorLowerBoundPixel, float colorUpperBoundPixel) const {
   // Save the previous curve view range
   DistributionCurveView * constCastedThis = const_cast<DistributionCurveView *>(this);
@@ -17,7 +17,10 @@ public:
     CurveView(distribution, nullptr, nullptr, nullptr),
     m_labels{},
     m_distribution(distribution),
-    m_calculation(calculation)
+    m_calculation(calculation),
+    m_histogramCacheParameters{NAN, NAN},
+    m_histogramCacheDistributionType(distribution->type()),
+    m_histogramCacheFirstAbscissa(0)
   {
     assert(distribution != nullptr);
     assert(calculation != nullptr);
@@ -30,11 +33,22 @@ protected:
 private:
   static float EvaluateAtAbscissa(float abscissa, void * model, void * context);
   static Poincare::Coordinate2D<float> EvaluateXYAtAbscissa(float abscissa, void * model, void * context);
+  static float EvaluateHistogramAtAbscissa(float abscissa, void * model, void * context);
+  /* The histogram bars are drawn at integer abscissas. Their heights are
+   * memoized as long as the distribution parameters do not change, so that
+   * redrawing the curve when the calculation bounds change does not evaluate
+   * the distribution again. */
+  constexpr static int k_histogramCacheSize = Ion::Display::Width;
+  void prepareHistogramCache() const;
   static constexpr KDColor k_backgroundColor = Palette::BackgroundApps;
   void drawStandardNormal(KDContext * ctx, KDRect rect, float colorLowerBound, float colorUpperBound) const;
   char m_labels[k_maxNumberOfXLabels][k_labelBufferMaxSize];
   Distribution * m_distribution;
   Calculation * m_calculation;
+  mutable float m_histogramCache[k_histogramCacheSize];
+  mutable double m_histogramCacheParameters[2];
+  mutable Distribution::Type m_histogramCacheDistributionType;
+  mutable int m_histogramCacheFirstAbscissa;
 };
 
 }
@@ -6,6 +6,7 @@
 #include "../distribution/binomial_distribution.h"
 #include "../distribution/chi_squared_distribution.h"
 #include "../distribution/geometric_distribution.h"
+#include "../distribution/poisson_distribution.h"
 #include "../distribution/student_distribution.h"
 #include "../distribution/fisher_distribution.h"
 
@@ -123,6 +124,31 @@ QUIZ_CASE(geometric_distribution) {
   assert_finite_integral_between_abscissas_is(&distribution, 1.0, 1.0, 0.4);
   assert_finite_integral_between_abscissas_is(&distribution, 2.0, 1.0, 0.0);
   assert_finite_integral_between_abscissas_is(&distribution, 2.0, 3.0, 0.384);
+
+  // Geometric distribution with probability of success 0.001
+  distribution.setParameterAtIndex(0.001, 0);
+  assert_cumulative_distributive_function_direct_and_inverse_is(&distribution, 500.0, 0.3936210551388149949636);
+}
+
+QUIZ_CASE(poisson_distribution) {
+  // Poisson distribution with lambda = 4
+  Probability::PoissonDistribution distribution;
+  distribution.setParameterAtIndex(4.0, 0);
+  assert_cumulative_distributive_function_direct_and_inverse_is(&distribution, 2.0, 0.2381033055535443438183);
+  assert_cumulative_distributive_function_direct_and_inverse_is(&distribution, 6.0, 0.8893260215974263098172);
+  assert_finite_integral_between_abscissas_is(&distribution, 2.0, 6.0, 0.7977478271537554083486);
+  // The whole interval underflows
+  assert_finite_integral_between_abscissas_is(&distribution, 2000.0, 1000000.0, 0.0);
+
+  // Poisson distribution with lambda = 9.5
+  distribution.setParameterAtIndex(9.5, 0);
+  assert_cumulative_distributive_function_direct_and_inverse_is(&distribution, 12.0, 0.8364297061231833504138);
+
+  // Poisson distribution with lambda = 250
+  distribution.setParameterAtIndex(250.0, 0);
+  assert_cumulative_distributive_function_direct_and_inverse_is(&distribution, 200.0, 0.0006132795361468573109938);
+  assert_finite_integral_between_abscissas_is(&distribution, 261.0, 300.0, 0.2504822604341726924417);
+  assert_finite_integral_between_abscissas_is(&distribution, 380.0, 400.0, 1.343662569380128617267e-14);
 }
 
 QUIZ_CASE(fisher_distribution) {
@@ -75,6 +75,19 @@ double LogisticModel::partialDerivate(double * modelCoefficients, int derivateCo
   return 1.0 / denominator;
 }
 
+void LogisticModel::partialDerivates(double * modelCoefficients, double x, double * derivates) const {
+  double a = modelCoefficients[0];
+  double b = modelCoefficients[1];
+  double c = modelCoefficients[2];
+  // exp(-b*x) is shared by all the derivates.
+  double exponential = exp(-b * x);
+  double denominator = 1.0 + a * exponential;
+  double factor = exponential * c / (denominator * denominator);
+  derivates[0] = -factor;
+  derivates[1] = x * a * factor;
+  derivates[2] = 1.0 / denominator;
+}
+
 void LogisticModel::specializedInitCoefficientsForFit(double * modelCoefficients, double defaultValue, Store * store, int series) const {
   assert(store != nullptr && series >= 0 && series < Store::k_numberOfSeries && !store->seriesIsEmpty(series));
   modelCoefficients[0] = defaultValue;
@@ -13,6 +13,7 @@ public:
   double evaluate(double * modelCoefficients, double x) const override;
   double levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
+  void partialDerivates(double * modelCoefficients, double x, double * derivates) const override;
   int numberOfCoefficients() const override { return 3; }
   int bannerLinesCount() const override { return 3; }
 private:
@@ -4,6 +4,8 @@
 #include <poincare/decimal.h>
 #include <poincare/matrix.h>
 #include <poincare/multiplication.h>
+#include <algorithm>
+#include <assert.h>
 #include <math.h>
 
 using namespace Poincare;
@@ -48,6 +50,85 @@ bool Model::dataSuitableForFit(Store * store, int series) const {
   return !store->seriesIsEmpty(series);
 }
 
+void Model::fitPolynomial(Store * store, int series, double * modelCoefficients, Context * context) {
+  /* Polynomial models are linear in their coefficients: the coefficients
+   * minimizing chi2 are the solution of the normal equations, which are solved
+   * directly instead of iterating. To keep the normal equations well
+   * conditioned, they are written for the reduced abscissa
+   * u = (x - meanOfX) / scale, which lies in [-1, 1]. The solution is then
+   * expanded back into a polynomial of x. */
+  if (!dataSuitableForFit(store, series)) {
+    initCoefficientsForFit(modelCoefficients, NAN, true);
+    return;
+  }
+  const int n = numberOfCoefficients();
+  const int degree = n - 1;
+  assert(degree > 0);
+  const int numberOfPoints = store->numberOfPairsOfSeries(series);
+  const double meanOfX = store->meanOfColumn(series, 0);
+  double scale = 0.0;
+  for (int i = 0; i < numberOfPoints; i++) {
+    scale = std::max(scale, std::fabs(store->get(series, 0, i) - meanOfX));
+  }
+  if (scale == 0.0) {
+    // All the abscissae are equal
+    initCoefficientsForFit(modelCoefficients, NAN, true);
+    return;
+  }
+
+  // Sums of u^k for k <= 2*degree and of y*u^k for k <= degree
+  double powerSums[2 * k_maxNumberOfCoefficients - 1];
+  double productSums[k_maxNumberOfCoefficients];
+  for (int k = 0; k <= 2 * degree; k++) {
+    powerSums[k] = 0.0;
+    if (k <= degree) {
+      productSums[k] = 0.0;
+    }
+  }
+  for (int i = 0; i < numberOfPoints; i++) {
+    const double u = (store->get(series, 0, i) - meanOfX) / scale;
+    const double y = store->get(series, 1, i);
+    double power = 1.0;
+    for (int k = 0; k <= 2 * degree; k++) {
+      powerSums[k] += power;
+      if (k <= degree) {
+        productSums[k] += y * power;
+      }
+      power *= u;
+    }
+  }
+
+  // The normal equations are sum(j, u^(i+j)) * c(j) = sum(y * u^i)
+  double coefficientsA[k_maxNumberOfCoefficients * k_maxNumberOfCoefficients];
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      coefficientsA[i*n+j] = powerSums[i+j];
+    }
+  }
+  double reducedCoefficients[k_maxNumberOfCoefficients];
+  if (solveLinearSystem(reducedCoefficients, coefficientsA, productSums, n, context) < 0) {
+    initCoefficientsForFit(modelCoefficients, NAN, true);
+    return;
+  }
+
+  /* Expand sum(c(k) * u^k) by Horner's method, with u = (x - meanOfX) / scale.
+   * expandedCoefficients[k] is the coefficient of x^k. */
+  double expandedCoefficients[k_maxNumberOfCoefficients];
+  for (int k = 0; k < n; k++) {
+    expandedCoefficients[k] = 0.0;
+  }
+  for (int k = degree; k >= 0; k--) {
+    for (int j = degree; j > 0; j--) {
+      expandedCoefficients[j] = (expandedCoefficients[j-1] - meanOfX * expandedCoefficients[j]) / scale;
+    }
+    expandedCoefficients[0] = reducedCoefficients[k] - meanOfX * expandedCoefficients[0] / scale;
+  }
+  // Model coefficients are ordered by decreasing degree
+  for (int k = 0; k < n; k++) {
+    modelCoefficients[k] = expandedCoefficients[degree - k];
+  }
+}
+
 void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Context * context) {
   /* We want to find the best coefficients of the regression to minimize the sum
    * of the squares of the difference between a data point and the corresponding
@@ -56,29 +137,41 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
    * function.
    * The equation to solve is A'*da = B, with A' a damped version of the chi2
    * Hessian matrix, da the coefficients increments and B colinear to the
-   * gradient of chi2.*/
+   * gradient of chi2.
+   * A and B only depend on the current coefficients: they are computed in a
+   * single pass over the data, and kept as long as steps are rejected, since a
+   * rejected step only changes the damping lambda. */
   double currentChi2 = chi2(store, series, modelCoefficients);
   double lambda = k_initialLambda;
   int n = numberOfCoefficients(); // n unknown coefficients
+  assert(n > 0); // Ensure that coefficientsA is initialized
+  double coefficientsA[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
+  double operandsB[Model::k_maxNumberOfCoefficients];
+  bool alphaAndBetaAreUpToDate = false;
   int smallChi2ChangeCounts = 0;
   int iterationCount = 0;
   while (smallChi2ChangeCounts < k_consecutiveSmallChi2ChangesLimit && iterationCount < k_maxIterations) {
-    // Create the alpha prime matrix (it is symmetric)
+    if (!alphaAndBetaAreUpToDate) {
+      alphaAndBetaCoefficients(store, series, modelCoefficients, coefficientsA, operandsB);
+      alphaAndBetaAreUpToDate = true;
+    }
+    /* Create the alpha prime matrix.
+     * The Levengerg method uses a'(k,k) = a(k,k) + lambda.
+     * The Marquardt method uses a'(k,k) = a(k,k) * (1 + lambda).
+     * We use a mixed method to try to make the matrix invertible:
+     * a'(k,k) = a(k,k) * (1 + lambda), but if a'(k,k) is too small,
+     * a'(k,k) = 2*epsilon so that the inversion method does not detect a'(k,k)
+     * as a zero. */
     double coefficientsAPrime[Model::k_maxNumberOfCoefficients * Model::k_maxNumberOfCoefficients];
-    assert(n > 0); // Ensure that coefficientsAPrime is initialized
+    for (int i = 0; i < n * n; i++) {
+      coefficientsAPrime[i] = coefficientsA[i];
+    }
     for (int i = 0; i < n; i++) {
-      for (int j = i; j < n; j++) {
-        double alphaPrime = alphaPrimeCoefficient(store, series, modelCoefficients, i, j, lambda);
-        coefficientsAPrime[i*n+j] = alphaPrime;
-        if (i != j) {
-          coefficientsAPrime[j*n+i] = alphaPrime;
-        }
+      double alphaPrime = coefficientsA[i*n+i] * (1.0 + lambda);
+      if (std::fabs(alphaPrime) < Expression::Epsilon<double>()) {
+        alphaPrime = 2*Expression::Epsilon<double>();
       }
-    }
-    // Create the beta matrix
-    double operandsB[Model::k_maxNumberOfCoefficients];
-    for (int j = 0; j < n; j++) {
-      operandsB[j] = betaCoefficient(store, series, modelCoefficients, j);
+      coefficientsAPrime[i*n+i] = alphaPrime;
     }
 
     // Compute the equation solution (= vector of coefficients increments)
@@ -104,6 +197,7 @@ void Model::fitLevenbergMarquardt(Store * store, int series, double * modelCoeff
         modelCoefficients[i] = newModelCoefficients[i];
       }
       currentChi2 = newChi2;
+      alphaAndBetaAreUpToDate = false;
     }
     iterationCount++;
   }
@@ -120,53 +214,43 @@ double Model::chi2(Store * store, int series, double * modelCoefficients) const
   return result;
 }
 
-// a'(k,k) = a(k,k) * (1 + lambda)
-// a'(k,l) = a(l,k) when (k != l)
-double Model::alphaPrimeCoefficient(Store * store, int series, double * modelCoefficients, int k, int l, double lambda) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  assert(l >= 0 && l < numberOfCoefficients());
-  double result = 0.0;
-  if (k == l) {
-    /* The Levengerg method uses a'(k,k) = a(k,k) + lambda.
-     * The Marquardt method uses a'(k,k) = a(k,k) * (1 + lambda).
-     * We use a mixed method to try to make the matrix invertible:
-     * a'(k,k) = a(k,k) * (1 + lambda), but if a'(k,k) is too small,
-     * a'(k,k) = 2*epsilon so that the inversion method does not detect a'(k,k)
-     * as a zero. */
-    result = alphaCoefficient(store, series, modelCoefficients, k, l)*(1.0+lambda);
-    if (std::fabs(result) < Expression::Epsilon<double>()) {
-      result = 2*Expression::Epsilon<double>();
-    }
-  } else {
-    result = alphaCoefficient(store, series, modelCoefficients, l, k);
+void Model::partialDerivates(double * modelCoefficients, double x, double * derivates) const {
+  const int n = numberOfCoefficients();
+  for (int k = 0; k < n; k++) {
+    derivates[k] = partialDerivate(modelCoefficients, k, x);
   }
-  return result;
-}
-
-// a(k,l) = sum(0, N-1, derivate(y(xi|a), ak) * derivate(y(xi|a), a))
-double Model::alphaCoefficient(Store * store, int series, double * modelCoefficients, int k, int l) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  assert(l >= 0 && l < numberOfCoefficients());
-  double result = 0.0;
-  int m = store->numberOfPairsOfSeries(series);
-  for (int i = 0; i < m; i++) {
-    double xi = store->get(series, 0, i);
-    result += partialDerivate(modelCoefficients, k, xi) * partialDerivate(modelCoefficients, l, xi);
-  }
-  return result;
 }
 
+// a(k,l) = sum(0, N-1, derivate(y(xi|a), ak) * derivate(y(xi|a), al))
 // b(k) = sum(0, N-1, (yi - y(xi|a)) * derivate(y(xi|a), ak))
-double Model::betaCoefficient(Store * store, int series, double * modelCoefficients, int k) const {
-  assert(k >= 0 && k < numberOfCoefficients());
-  double result = 0.0;
+void Model::alphaAndBetaCoefficients(Store * store, int series, double * modelCoefficients, double * alpha, double * beta) const {
+  const int n = numberOfCoefficients();
+  for (int k = 0; k < n; k++) {
+    beta[k] = 0.0;
+    for (int l = k; l < n; l++) {
+      alpha[k*n+l] = 0.0;
+    }
+  }
   int m = store->numberOfPairsOfSeries(series); // m equations
   for (int i = 0; i < m; i++) {
     double xi = store->get(series, 0, i);
     double yi = store->get(series, 1, i);
-    result += (yi - evaluate(modelCoefficients, xi)) * partialDerivate(modelCoefficients, k, xi);
+    double derivates[k_maxNumberOfCoefficients];
+    partialDerivates(modelCoefficients, xi, derivates);
+    double difference = yi - evaluate(modelCoefficients, xi);
+    for (int k = 0; k < n; k++) {
+      beta[k] += difference * derivates[k];
+      for (int l = k; l < n; l++) {
+        alpha[k*n+l] += derivates[k] * derivates[l];
+      }
+    }
+  }
+  // alpha is symmetric
+  for (int k = 0; k < n; k++) {
+    for (int l = 0; l < k; l++) {
+      alpha[k*n+l] = alpha[l*n+k];
+    }
   }
-  return result;
 }
 
 int Model::solveLinearSystem(double * solutions, double * coefficients, double * constants, int solutionDimension, Context * context) {
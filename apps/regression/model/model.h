@@ -41,12 +41,16 @@ public:
 protected:
   // Fit
   virtual bool dataSuitableForFit(Store * store, int series) const;
+  void fitPolynomial(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
+  void initCoefficientsForFit(double * modelCoefficients, double defaultValue, bool forceDefaultValue, Store * store = nullptr, int series = -1) const;
   constexpr static const KDFont * k_layoutFont = KDFont::SmallFont;
   Poincare::Layout m_layout;
 private:
   // Model attributes
   virtual Poincare::Expression expression(double * modelCoefficients) { return Poincare::Expression(); } // expression is overrided only by Models that do not override levelSet
   virtual double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const = 0;
+  // Fill derivates with the partial derivates with respect to each coefficient
+  virtual void partialDerivates(double * modelCoefficients, double x, double * derivates) const;
 
   // Levenberg-Marquardt
   static constexpr double k_maxIterations = 300;
@@ -58,11 +62,8 @@ private:
   static constexpr int k_consecutiveSmallChi2ChangesLimit = 10;
   void fitLevenbergMarquardt(Store * store, int series, double * modelCoefficients, Poincare::Context * context);
   double chi2(Store * store, int series, double * modelCoefficients) const;
-  double alphaPrimeCoefficient(Store * store, int series, double * modelCoefficients, int k, int l, double lambda) const;
-  double alphaCoefficient(Store * store, int series, double * modelCoefficients, int k, int l) const;
-  double betaCoefficient(Store * store, int series, double * modelCoefficients, int k) const;
+  void alphaAndBetaCoefficients(Store * store, int series, double * modelCoefficients, double * alpha, double * beta) const;
   int solveLinearSystem(double * solutions, double * coefficients, double * constants, int solutionDimension, Poincare::Context * context);
-  void initCoefficientsForFit(double * modelCoefficients, double defaultValue, bool forceDefaultValue, Store * store = nullptr, int series = -1) const;
   virtual void specializedInitCoefficientsForFit(double * modelCoefficients, double defaultValue, Store * store = nullptr, int series = -1) const;
   virtual void uniformizeCoefficientsFromFit(double * modelCoefficients) const {}
 };
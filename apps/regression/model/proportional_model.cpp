@@ -2,6 +2,7 @@
 #include "../store.h"
 #include <poincare/layout_helper.h>
 #include <assert.h>
+#include <cmath>
 
 using namespace Poincare;
 
@@ -27,6 +28,16 @@ double ProportionalModel::levelSet(double * modelCoefficients, double xMin, doub
   return y/a;
 }
 
+void ProportionalModel::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
+  // The least squares solution of y = a*x is a = sum(x*y)/sum(x^2)
+  double squaredValueSum = store->squaredValueSumOfColumn(series, 0);
+  if (!dataSuitableForFit(store, series) || squaredValueSum == 0.0) {
+    initCoefficientsForFit(modelCoefficients, NAN, true);
+    return;
+  }
+  modelCoefficients[0] = store->columnProductSum(series) / squaredValueSum;
+}
+
 double ProportionalModel::partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const {
   assert(derivateCoefficientIndex == 0);
   // Derivate: x
@@ -11,6 +11,7 @@ public:
   Poincare::Layout layout() override;
   I18n::Message formulaMessage() const override { return I18n::Message::QuarticRegressionFormula; }
   double evaluate(double * modelCoefficients, double x) const override;
+  void fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) override { fitPolynomial(store, series, modelCoefficients, context); }
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
   int numberOfCoefficients() const override { return 5; }
   int bannerLinesCount() const override { return 4; }
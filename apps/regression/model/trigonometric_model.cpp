@@ -64,6 +64,19 @@ double TrigonometricModel::partialDerivate(double * modelCoefficients, int deriv
   return radian * a * std::cos(radian * (b * x + c));
 }
 
+void TrigonometricModel::partialDerivates(double * modelCoefficients, double x, double * derivates) const {
+  double a = modelCoefficients[0];
+  double b = modelCoefficients[1];
+  double c = modelCoefficients[2];
+  double radian = toRadians();
+  // sin(b*x+c) and cos(b*x+c) are shared by all the derivates.
+  double cosine = radian * a * std::cos(radian * (b * x + c));
+  derivates[0] = std::sin(radian * (b * x + c));
+  derivates[1] = x * cosine;
+  derivates[2] = cosine;
+  derivates[3] = 1.0;
+}
+
 void TrigonometricModel::specializedInitCoefficientsForFit(double * modelCoefficients, double defaultValue, Store * store, int series) const {
   assert(store != nullptr && series >= 0 && series < Store::k_numberOfSeries && !store->seriesIsEmpty(series));
   /* We try a better initialization than the default value. We hope that this
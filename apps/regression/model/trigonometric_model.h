@@ -12,6 +12,7 @@ public:
   I18n::Message formulaMessage() const override { return I18n::Message::TrigonometricRegressionFormula; }
   double evaluate(double * modelCoefficients, double x) const override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
+  void partialDerivates(double * modelCoefficients, double x, double * derivates) const override;
   int numberOfCoefficients() const override { return k_numberOfCoefficients; }
   int bannerLinesCount() const override { return 4; }
 private:
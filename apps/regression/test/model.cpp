@@ -1,6 +1,7 @@
 #include <quiz.h>
 #include <string.h>
 #include <assert.h>
+#include <cmath>
 #include <apps/shared/global_context.h>
 #include "../model/model.h"
 #include "../regression_context.h"
@@ -112,6 +113,30 @@ QUIZ_CASE(proportional_regression5) {
   assert_regression_is(x, y, numberOfPoints, Model::Type::Proportional, coefficients, r2);
 }
 
+void assert_regression_is_undefined(double * xi, double * yi, int numberOfPoints, Model::Type modelType) {
+  int series = 0;
+  Regression::Store store;
+  setRegressionPoints(&store, series, numberOfPoints, xi, yi);
+  store.setSeriesRegressionType(series, modelType);
+  Shared::GlobalContext globalContext;
+  RegressionContext context(&store, &globalContext);
+  double * coefficients = store.coefficientsForSeries(series, &context);
+  int numberOfCoefs = store.modelForSeries(series)->numberOfCoefficients();
+  for (int i = 0; i < numberOfCoefs; i++) {
+    quiz_assert(std::isnan(coefficients[i]));
+  }
+}
+
+QUIZ_CASE(regression_with_equal_abscissae) {
+  double x[] = {1.0, 1.0};
+  double y[] = {2.0, 3.0};
+  assert_regression_is_undefined(x, y, 2, Model::Type::Quadratic);
+  assert_regression_is_undefined(x, y, 2, Model::Type::Cubic);
+  assert_regression_is_undefined(x, y, 2, Model::Type::Quartic);
+  double zeros[] = {0.0, 0.0};
+  assert_regression_is_undefined(zeros, y, 2, Model::Type::Proportional);
+}
+
 QUIZ_CASE(quadratic_regression) {
   double x[] = {-34.0, -12.0, 5.0, 86.0, -2.0};
   double y[] = {-8241.389, -1194.734, -59.163, - 46245.39, -71.774};
@@ -136,6 +161,20 @@ QUIZ_CASE(quartic_regression) {
   assert_regression_is(x, y, 10, Model::Type::Quartic, coefficients, r2);
 }
 
+QUIZ_CASE(quartic_regression2) {
+  // A full series, far from the origin, without noise
+  constexpr int numberOfPoints = Regression::Store::k_maxNumberOfPairs;
+  double coefficients[] = {0.5, -3.0, 2.0, -1.0, 4.0};
+  double x[numberOfPoints];
+  double y[numberOfPoints];
+  for (int i = 0; i < numberOfPoints; i++) {
+    x[i] = 50.0 + 0.5 * i;
+    y[i] = (((coefficients[0] * x[i] + coefficients[1]) * x[i] + coefficients[2]) * x[i] + coefficients[3]) * x[i] + coefficients[4];
+  }
+  double r2 = 1.0;
+  assert_regression_is(x, y, numberOfPoints, Model::Type::Quartic, coefficients, r2);
+}
+
 QUIZ_CASE(logarithmic_regression) {
   double x[] = {0.2, 0.5, 5, 7};
   double y[] = {-11.952, -9.035, -1.695, -0.584};
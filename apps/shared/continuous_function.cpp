@@ -52,7 +52,7 @@ void ContinuousFunction::DefaultName(char buffer[], size_t bufferSize) {
 }
 
 ContinuousFunction ContinuousFunction::NewModel(Ion::Storage::Record::ErrorStatus * error, const char * baseName) {
-  static int s_colorIndex = 0;
+  static ION_THREAD_LOCAL int s_colorIndex = 0;
   // Create the record
   char nameBuffer[SymbolAbstract::k_maxNameSize];
   RecordDataBuffer data(Palette::nextDataColor(&s_colorIndex));
@@ -210,7 +210,8 @@ bool ContinuousFunction::displayDerivative() const {
 }
 
 void ContinuousFunction::setDisplayDerivative(bool display) {
-  return recordData()->setDisplayDerivative(display);
+  recordData()->setDisplayDerivative(display);
+  Ion::Storage::sharedStorage()->invalidateChecksum();
 }
 
 int ContinuousFunction::printValue(double cursorT, double cursorX, double cursorY, char * buffer, int bufferSize, int precision, Poincare::Context * context) {
@@ -236,11 +237,14 @@ double ContinuousFunction::approximateDerivative(double x, Poincare::Context * c
   if (x < tMin() || x > tMax()) {
     return NAN;
   }
-  Poincare::Derivative derivative = Poincare::Derivative::Builder(expressionReduced(context).clone(), Symbol::Builder(UCodePointUnknown), Poincare::Float<double>::Builder(x)); // derivative takes ownership of Poincare::Float<double>::Builder(x) and the clone of expression
-  /* TODO: when we approximate derivative, we might want to simplify the
-   * derivative here. However, we might want to do it once for all x (to avoid
-   * lagging in the derivative table. */
-  return PoincareHelpers::ApproximateToScalar<double>(derivative, context);
+  /* The derivative is simplified once for all abscissas and cached in the
+   * model. If it could not be computed symbolically, it still contains a
+   * Derivative node that is approximated numerically. */
+  Expression derivative = m_model.expressionDerivateReduced(this, context);
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  return PoincareHelpers::ApproximateWithValueForSymbol(derivative, unknown, x, context);
 }
 
 float ContinuousFunction::tMin() const {
@@ -253,15 +257,28 @@ float ContinuousFunction::tMax() const {
 
 void ContinuousFunction::setTMin(float tMin) {
   recordData()->setTMin(tMin);
+  Ion::Storage::sharedStorage()->invalidateChecksum();
   setCache(nullptr);
 }
 
 void ContinuousFunction::setTMax(float tMax) {
   recordData()->setTMax(tMax);
+  Ion::Storage::sharedStorage()->invalidateChecksum();
   setCache(nullptr);
 }
 
 void ContinuousFunction::rangeForDisplay(float * xMin, float * xMax, float * yMin, float * yMax, float targetRatio, Poincare::Context * context) const {
+  uint32_t storageChecksum = Ion::Storage::sharedStorage()->checksum();
+  Preferences * preferences = Preferences::sharedPreferences();
+  if (m_rangeForDisplayMemo.matches(storageChecksum, targetRatio, preferences->angleUnit(), preferences->complexFormat())) {
+    m_rangeForDisplayMemo.get(xMin, xMax, yMin, yMax);
+    return;
+  }
+  privateRangeForDisplay(xMin, xMax, yMin, yMax, targetRatio, context);
+  m_rangeForDisplayMemo.set(storageChecksum, targetRatio, preferences->angleUnit(), preferences->complexFormat(), *xMin, *xMax, *yMin, *yMax);
+}
+
+void ContinuousFunction::privateRangeForDisplay(float * xMin, float * xMax, float * yMin, float * yMax, float targetRatio, Poincare::Context * context) const {
   if (plotType() != PlotType::Cartesian) {
     assert(std::isfinite(tMin()) && std::isfinite(tMax()) && std::isfinite(rangeStep()) && rangeStep() > 0);
     protectedFullRangeForDisplay(tMin(), tMax(), rangeStep(), xMin, xMax, context, true);
@@ -323,10 +340,46 @@ void ContinuousFunction::rangeForDisplay(float * xMin, float * xMax, float * yMi
   *yMax = NAN;
 }
 
+void ContinuousFunction::RangeForDisplayMemo::set(uint32_t storageChecksum, float targetRatio, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat, float xMin, float xMax, float yMin, float yMax) {
+  m_storageChecksum = storageChecksum;
+  m_targetRatio = targetRatio;
+  m_angleUnit = angleUnit;
+  m_complexFormat = complexFormat;
+  m_xMin = xMin;
+  m_xMax = xMax;
+  m_yMin = yMin;
+  m_yMax = yMax;
+}
+
+void ContinuousFunction::RangeForDisplayMemo::get(float * xMin, float * xMax, float * yMin, float * yMax) const {
+  *xMin = m_xMin;
+  *xMax = m_xMax;
+  *yMin = m_yMin;
+  *yMax = m_yMax;
+}
+
 void * ContinuousFunction::Model::expressionAddress(const Ion::Storage::Record * record) const {
   return (char *)record->value().buffer+sizeof(RecordDataBuffer);
 }
 
+Expression ContinuousFunction::Model::expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const {
+  if (m_expressionDerivate.isUninitialized()) {
+    Expression derivative = Poincare::Derivative::Builder(expressionReduced(record, context).clone(), Symbol::Builder(UCodePointUnknown), Symbol::Builder(UCodePointUnknown));
+    m_expressionDerivate = derivative.clone();
+    PoincareHelpers::Simplify(&m_expressionDerivate, context, ExpressionNode::ReductionTarget::SystemForApproximation);
+    // Simplify might return an uninitialized Expression if interrupted
+    if (m_expressionDerivate.isUninitialized()) {
+      m_expressionDerivate = derivative;
+    }
+  }
+  return m_expressionDerivate;
+}
+
+void ContinuousFunction::Model::tidy() const {
+  m_expressionDerivate = Expression();
+  ExpressionModel::tidy();
+}
+
 size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * record) const {
   return record->value().size-sizeof(RecordDataBuffer);
 }
@@ -359,6 +412,23 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
       PoincareHelpers::ApproximateWithValueForSymbol(e.childAtIndex(1), unknown, t, context));
 }
 
+Interval ContinuousFunction::evaluateYIntervalBetween(float xMin, float xMax, Context * context) const {
+  assert(plotType() == PlotType::Cartesian);
+  float start = std::max(xMin, tMin());
+  float end = std::min(xMax, tMax());
+  if (!(start <= end)) {
+    return Interval::Empty();
+  }
+  constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+  char unknown[bufferSize];
+  Poincare::SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+  Interval yBounds = expressionReduced(context).approximateOnIntervalForSymbol(unknown, start, end, Preferences::sharedPreferences()->angleUnit());
+  if (start != xMin || end != xMax) {
+    return Interval(yBounds.lowerBound(), yBounds.upperBound(), false);
+  }
+  return yBounds;
+}
+
 Coordinate2D<double> ContinuousFunction::nextMinimumFrom(double start, double step, double max, Context * context) const {
   return nextPointOfInterestFrom(start, step, max, context, [](Expression e, char * symbol, double start, double step, double max, Context * context) { return PoincareHelpers::NextMinimum(e, symbol, start, step, max, context); });
 }
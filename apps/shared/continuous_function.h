@@ -27,11 +27,13 @@ public:
   static ContinuousFunction NewModel(Ion::Storage::Record::ErrorStatus * error, const char * baseName = nullptr);
   ContinuousFunction(Ion::Storage::Record record = Record()) :
     Function(record),
-    m_cache(nullptr)
+    m_cache(nullptr),
+    m_rangeForDisplayMemo()
   {}
   I18n::Message parameterMessageName() const override;
   CodePoint symbol() const override;
   Poincare::Expression expressionReduced(Poincare::Context * context) const override;
+  bool dependsOnRecord(const Ion::Storage::Record changedRecord, Poincare::Context * context) const override { return m_model.dependsOnRecord(this, changedRecord, context); }
 
   static constexpr int k_numberOfPlotTypes = 3;
   enum class PlotType : uint8_t {
@@ -53,6 +55,9 @@ public:
   Poincare::Coordinate2D<double> evaluateXYAtParameter(double t, Poincare::Context * context) const override {
     return privateEvaluateXYAtParameter<double>(t, context);
   }
+  /* Bounds of the values of a cartesian function for x in [xMin, xMax]. The
+   * function is not continuous on [xMin, xMax] if it exceeds [tMin, tMax]. */
+  Poincare::Interval evaluateYIntervalBetween(float xMin, float xMax, Poincare::Context * context) const;
 
   // Derivative
   bool displayDerivative() const;
@@ -92,6 +97,7 @@ private:
   template <typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context) const;
   void didBecomeInactive() override { m_cache = nullptr; }
 
+  void privateRangeForDisplay(float * xMin, float * xMax, float * yMin, float * yMax, float targetRatio, Poincare::Context * context) const;
   void fullXYRange(float * xMin, float * xMax, float * yMin, float * yMax, Poincare::Context * context) const;
   bool basedOnCostlyAlgorithms(Poincare::Context * context) const;
 
@@ -123,16 +129,43 @@ private:
     //char m_expression[0];
   };
   class Model : public ExpressionModel {
+  public:
+    Poincare::Expression expressionDerivateReduced(const Ion::Storage::Record * record, Poincare::Context * context) const;
+    void tidy() const override;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    mutable Poincare::Expression m_expressionDerivate;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
   RecordDataBuffer * recordData() const;
   template<typename T> Poincare::Coordinate2D<T> templatedApproximateAtParameter(T t, Poincare::Context * context) const;
+  /* The zoom search evaluates the function several hundred times, and is run
+   * each time the graph appears with an automatic range. Its result only
+   * depends on the storage, which holds the function and everything it might
+   * refer to, on the target ratio and on the evaluation preferences. */
+  class RangeForDisplayMemo {
+  public:
+    RangeForDisplayMemo() : m_storageChecksum(0), m_targetRatio(NAN) {}
+    bool matches(uint32_t storageChecksum, float targetRatio, Poincare::Preferences::AngleUnit angleUnit, Poincare::Preferences::ComplexFormat complexFormat) const {
+      return m_storageChecksum == storageChecksum && m_targetRatio == targetRatio && m_angleUnit == angleUnit && m_complexFormat == complexFormat;
+    }
+    void set(uint32_t storageChecksum, float targetRatio, Poincare::Preferences::AngleUnit angleUnit, Poincare::Preferences::ComplexFormat complexFormat, float xMin, float xMax, float yMin, float yMax);
+    void get(float * xMin, float * xMax, float * yMin, float * yMax) const;
+  private:
+    uint32_t m_storageChecksum;
+    float m_targetRatio;
+    Poincare::Preferences::AngleUnit m_angleUnit;
+    Poincare::Preferences::ComplexFormat m_complexFormat;
+    float m_xMin;
+    float m_xMax;
+    float m_yMin;
+    float m_yMax;
+  };
   Model m_model;
   ContinuousFunctionCache * m_cache;
+  mutable RangeForDisplayMemo m_rangeForDisplayMemo;
 };
 
 }
@@ -6,6 +6,7 @@ namespace Shared {
 
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
+constexpr float ContinuousFunctionCache::k_nonCartesianCacheHitTolerance;
 constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
 
 // public
@@ -28,12 +29,13 @@ void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCa
     function->setCache(nullptr);
     return;
   }
-  if (function->cache() != cache) {
-    cache->clear();
-    function->setCache(cache);
-  } else if (tStep != 0.f && tStep != cache->step()) {
+  uint32_t storageChecksum = Ion::Storage::sharedStorage()->checksum();
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  if (!cache->isValidFor(function, storageChecksum, preferences) || (tStep != 0.f && tStep != cache->step())) {
     cache->clear();
+    cache->setValidity(function, storageChecksum, preferences);
   }
+  function->setCache(cache);
 
   if (function->plotType() == ContinuousFunction::PlotType::Cartesian && tStep != 0) {
     function->cache()->pan(function, tMin);
@@ -58,10 +60,9 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valueForParameter(const C
 void ContinuousFunctionCache::ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin) {
   // Expected step length
   *tStep = (tMax - tMin) / Graph::GraphView::k_graphStepDenominator;
-  /* Parametric and polar functions require caching both x and y values,
-   * with the same k_sizeOfCache. To cover the entire range,
-   * number of cacheable points is half the cache size. */
-  const int numberOfCacheablePoints = k_sizeOfCache / 2;
+  /* Parametric and polar functions require caching both x and y values, on
+   * k_numberOfNonCartesianCacheablePoints covering the entire range. */
+  const int numberOfCacheablePoints = k_numberOfNonCartesianCacheablePoints;
   const int numberOfWholeSteps = static_cast<int>(Graph::GraphView::k_graphStepDenominator);
   static_assert(numberOfCacheablePoints % numberOfWholeSteps == 0, "numberOfCacheablePoints should be a multiple of numberOfWholeSteps for optimal caching");
   const int multiple = numberOfCacheablePoints / numberOfWholeSteps;
@@ -78,6 +79,21 @@ void ContinuousFunctionCache::ComputeNonCartesianSteps(float * tStep, float * tC
 }
 
 // private
+bool ContinuousFunctionCache::isValidFor(const ContinuousFunction * function, uint32_t storageChecksum, Poincare::Preferences * preferences) const {
+  return !m_record.isNull()
+      && m_record == *function
+      && m_storageChecksum == storageChecksum
+      && m_angleUnit == preferences->angleUnit()
+      && m_complexFormat == preferences->complexFormat();
+}
+
+void ContinuousFunctionCache::setValidity(const ContinuousFunction * function, uint32_t storageChecksum, Poincare::Preferences * preferences) {
+  m_record = *function;
+  m_storageChecksum = storageChecksum;
+  m_angleUnit = preferences->angleUnit();
+  m_complexFormat = preferences->complexFormat();
+}
+
 void ContinuousFunctionCache::invalidateBetween(int iInf, int iSup) {
   for (int i = iInf; i < iSup; i++) {
     m_cache[i] = NAN;
@@ -96,13 +112,14 @@ int ContinuousFunctionCache::indexForParameter(const ContinuousFunction * functi
   }
   int res = std::round(delta);
   assert(res >= 0);
-  if ((res >= k_sizeOfCache && function->plotType() == ContinuousFunction::PlotType::Cartesian)
-   || (res >= k_sizeOfCache / 2 && function->plotType() != ContinuousFunction::PlotType::Cartesian)
-   || std::fabs(res - delta) > k_cacheHitTolerance) {
+  if (function->plotType() != ContinuousFunction::PlotType::Cartesian) {
+    assert(m_startOfCache == 0);
+    return res >= k_numberOfNonCartesianCacheablePoints || std::fabs(res - delta) > k_nonCartesianCacheHitTolerance ? -1 : res;
+  }
+  if (res >= k_numberOfCartesianCacheablePoints || std::fabs(res - delta) > k_cacheHitTolerance) {
     return -1;
   }
-  assert(function->plotType() == ContinuousFunction::PlotType::Cartesian || m_startOfCache == 0);
-  return (res + m_startOfCache) % k_sizeOfCache;
+  return (res + m_startOfCache) % k_numberOfCartesianCacheablePoints;
 }
 
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i) {
@@ -133,26 +150,26 @@ void ContinuousFunctionCache::pan(ContinuousFunction * function, float newTMin)
     return;
   }
   int dI = std::round(dT);
-  if (dI >= k_sizeOfCache || dI <= -k_sizeOfCache || std::fabs(dT - dI) > k_cacheHitTolerance) {
+  if (dI >= k_numberOfCartesianCacheablePoints || dI <= -k_numberOfCartesianCacheablePoints || std::fabs(dT - dI) > k_cacheHitTolerance) {
     clear();
     return;
   }
 
   int oldStart = m_startOfCache;
-  m_startOfCache = (m_startOfCache + dI) % k_sizeOfCache;
+  m_startOfCache = (m_startOfCache + dI) % k_numberOfCartesianCacheablePoints;
   if (m_startOfCache < 0) {
-    m_startOfCache += k_sizeOfCache;
+    m_startOfCache += k_numberOfCartesianCacheablePoints;
   }
   if (dI > 0) {
     if (m_startOfCache > oldStart) {
       invalidateBetween(oldStart, m_startOfCache);
     } else {
-      invalidateBetween(oldStart, k_sizeOfCache);
+      invalidateBetween(oldStart, k_numberOfCartesianCacheablePoints);
       invalidateBetween(0, m_startOfCache);
     }
   } else {
     if (m_startOfCache > oldStart) {
-      invalidateBetween(m_startOfCache, k_sizeOfCache);
+      invalidateBetween(m_startOfCache, k_numberOfCartesianCacheablePoints);
       invalidateBetween(0, oldStart);
     } else {
       invalidateBetween(m_startOfCache, oldStart);
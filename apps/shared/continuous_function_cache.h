@@ -3,8 +3,10 @@
 
 #include "../graph/graph/graph_view.h"
 #include <ion/display.h>
+#include <ion/storage.h>
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
+#include <poincare/preferences.h>
 
 namespace Shared {
 
@@ -24,9 +26,19 @@ public:
   // Sets step parameters for non-cartesian curves
   static void ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin);
 private:
-  /* The size of the cache is chosen to optimize the display of cartesian
-   * functions */
-  static constexpr int k_sizeOfCache = Ion::Display::Width;
+  /* The number of cartesian points is chosen to optimize the display of
+   * cartesian functions. Parametric and polar functions are drawn on a
+   * handful of steps, recursively divided by CurveView::joinDots. The device
+   * caches both coordinates on half as many points, which covers the first
+   * recursion levels. Host builds cache every recursion level, so that
+   * redrawing part of a non-cartesian curve does not evaluate it again. */
+  static constexpr int k_numberOfCartesianCacheablePoints = Ion::Display::Width;
+#if PLATFORM_DEVICE
+  static constexpr int k_numberOfNonCartesianCacheablePoints = k_numberOfCartesianCacheablePoints / 2;
+#else
+  static constexpr int k_numberOfNonCartesianCacheablePoints = 10 * 1024;
+#endif
+  static constexpr int k_sizeOfCache = 2 * k_numberOfNonCartesianCacheablePoints > k_numberOfCartesianCacheablePoints ? 2 * k_numberOfNonCartesianCacheablePoints : k_numberOfCartesianCacheablePoints;
   /* We need a certain amount of tolerance since we try to evaluate the
    * equality of floats. But the value has to be chosen carefully. Too high of
    * a tolerance causes false positives, which lead to errors in curves
@@ -36,13 +48,24 @@ private:
    * The value 128*FLT_EPSILON has been found to be the lowest for which all
    * indices verify indexForParameter(tMin + index * tStep) = index. */
   static constexpr float k_cacheHitTolerance = 128.0f * FLT_EPSILON;
+  /* The rounding error on the index grows with the number of cached points. */
+  static constexpr float k_nonCartesianCacheHitTolerance = k_cacheHitTolerance * (k_numberOfNonCartesianCacheablePoints / (k_numberOfCartesianCacheablePoints / 2));
 
+  /* The values depend on the function record, on the records it refers to and
+   * on the preferences. The cache is kept as long as they do not change, even
+   * if the function is memoized again in the meantime. */
+  bool isValidFor(const ContinuousFunction * function, uint32_t storageChecksum, Poincare::Preferences * preferences) const;
+  void setValidity(const ContinuousFunction * function, uint32_t storageChecksum, Poincare::Preferences * preferences);
   void invalidateBetween(int iInf, int iSup);
   void setRange(ContinuousFunction * function, float tMin, float tStep);
   int indexForParameter(const ContinuousFunction * function, float t) const;
   Poincare::Coordinate2D<float> valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i);
   void pan(ContinuousFunction * function, float newTMin);
 
+  Ion::Storage::Record m_record;
+  uint32_t m_storageChecksum;
+  Poincare::Preferences::AngleUnit m_angleUnit;
+  Poincare::Preferences::ComplexFormat m_complexFormat;
   float m_tMin, m_tStep;
   float m_cache[k_sizeOfCache];
   /* m_startOfCache is used to implement a circular buffer for easy panning
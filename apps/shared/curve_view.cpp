@@ -622,8 +622,11 @@ const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
 #endif
 
 constexpr static int k_maxNumberOfIterations = 10;
+/* Width, in steps, of the blocks of a cartesian curve that are bounded at
+ * once to be skipped if out of rect. */
+constexpr static int k_numberOfStepsPerBoundedBlock = 16;
 
-void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation) const {
   float previousT = NAN;
   float t = NAN;
   float previousX = NAN;
@@ -654,11 +657,11 @@ void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd
     if (colorUnderCurve && !std::isnan(x) && colorLowerBound < x && x < colorUpperBound && !(std::isnan(y) || std::isinf(y))) {
       drawHorizontalOrVerticalSegment(ctx, rect, Axis::Vertical, x, std::min(0.0f, y), std::max(0.0f, y), color, 1);
     }
-    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, k_maxNumberOfIterations, xyDoubleEvaluation);
+    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, previousT, previousX, previousY, t, x, y, color, thick, k_maxNumberOfIterations, xyDoubleEvaluation, yIntervalEvaluation);
   } while (!isLastSegment);
 }
 
-void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, float xMax, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation, KDCoordinate pixelStep, EvaluateYIntervalForXInterval yIntervalEvaluation) const {
   float rectLeft = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
   float rectRight = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
   float tStart = std::isnan(rectLeft) ? xMin : std::max(xMin, rectLeft);
@@ -667,8 +670,36 @@ void CurveView::drawCartesianCurve(KDContext * ctx, KDRect rect, float xMin, flo
   if (std::isinf(tStart) || std::isinf(tEnd) || tStart > tEnd) {
     return;
   }
-  float tStep = pixelWidth();
-  drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation);
+  float tStep = pixelStep * pixelWidth();
+  if (yIntervalEvaluation == nullptr || (colorUnderCurve && colorLowerBound < colorUpperBound)) {
+    // The area under the curve has to be colored even where the curve is out of rect
+    drawCurve(ctx, rect, tStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation, yIntervalEvaluation);
+    return;
+  }
+  /* Bound the curve on blocks of columns and only draw the runs of blocks on
+   * which it might be visible. Blocks start on multiples of tStep so that the
+   * dots drawn are the same as if the curve was drawn at once. */
+  const float blockLength = k_numberOfStepsPerBoundedBlock * tStep;
+  float runStart = tStart;
+  float blockStart = tStart;
+  int i = 0;
+  while (blockStart < tEnd) {
+    float blockEnd = std::min(tStart + (++i) * blockLength, tEnd);
+    if (blockEnd <= blockStart) {
+      // blockLength is negligible compared to tStart
+      blockEnd = tEnd;
+    }
+    if (verticalBoundsAreOutOfRect(yIntervalEvaluation(blockStart, blockEnd, model, context), rect, thick)) {
+      if (runStart < blockStart) {
+        drawCurve(ctx, rect, runStart, blockStart, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation, yIntervalEvaluation);
+      }
+      runStart = blockEnd;
+    }
+    blockStart = blockEnd;
+  }
+  if (runStart < tEnd) {
+    drawCurve(ctx, rect, runStart, tEnd, tStep, xyFloatEvaluation, model, context, true, color, thick, colorUnderCurve, colorLowerBound, colorUpperBound, xyDoubleEvaluation, yIntervalEvaluation);
+  }
 }
 
 float PolarThetaFromCoordinates(float x, float y, Preferences::AngleUnit angleUnit) {
@@ -831,7 +862,17 @@ static bool pointInBoundingBox(float x1, float y1, float x2, float y2, float xC,
       && ((y1 <= yC && yC <= y2) || (y2 <= yC && yC <= y1));
 }
 
-void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParameter xyFloatEvaluation , void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
+bool CurveView::verticalBoundsAreOutOfRect(Interval yBounds, KDRect rect, bool thick) const {
+  if (yBounds.isEmpty()) {
+    return true;
+  }
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+  // The vertical axis is oriented downwards in pixels
+  return floatToPixel(Axis::Vertical, yBounds.lowerBound()) < rect.top() - stampSize
+      || floatToPixel(Axis::Vertical, yBounds.upperBound()) > rect.bottom() + stampSize;
+}
+
+void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParameter xyFloatEvaluation , void * model, void * context, bool drawStraightLinesEarly, float t, float x, float y, float s, float u, float v, KDColor color, bool thick, int maxNumberOfRecursion, EvaluateXYForDoubleParameter xyDoubleEvaluation, EvaluateYIntervalForXInterval yIntervalEvaluation) const {
   const bool isFirstDot = std::isnan(t);
   const bool isLeftDotValid = !(
       std::isnan(x) || std::isinf(x) ||
@@ -861,6 +902,20 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParamet
       return;
     }
   }
+  if (yIntervalEvaluation && !isFirstDot) {
+    Interval yBounds = yIntervalEvaluation(t, s, model, context);
+    if (verticalBoundsAreOutOfRect(yBounds, rect, thick)) {
+      return;
+    }
+    if (isLeftDotValid && isRightDotValid && yBounds.isContinuous()
+        && floatToPixel(Axis::Vertical, yBounds.upperBound()) >= std::min(pyf, pvf) - 1.0f
+        && floatToPixel(Axis::Vertical, yBounds.lowerBound()) <= std::max(pyf, pvf) + 1.0f) {
+      /* The curve is continuous between the dots and stays within a pixel of
+       * the ordinates they span : a straight line is close enough. */
+      straightJoinDots(ctx, rect, pxf, pyf, puf, pvf, color, thick);
+      return;
+    }
+  }
   // Middle point
   float ct = (t + s)/2.0f;
   Coordinate2D<float> cxy = xyFloatEvaluation(ct, model, context);
@@ -907,8 +962,8 @@ void CurveView::joinDots(KDContext * ctx, KDRect rect, EvaluateXYForFloatParamet
       nextMaxNumberOfRecursion--;
     }
 
-    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, t, x, y, ct, cx, cy, color, thick, nextMaxNumberOfRecursion, xyDoubleEvaluation);
-    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, ct, cx, cy, s, u, v, color, thick, nextMaxNumberOfRecursion, xyDoubleEvaluation);
+    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, t, x, y, ct, cx, cy, color, thick, nextMaxNumberOfRecursion, xyDoubleEvaluation, yIntervalEvaluation);
+    joinDots(ctx, rect, xyFloatEvaluation, model, context, drawStraightLinesEarly, ct, cx, cy, s, u, v, color, thick, nextMaxNumberOfRecursion, xyDoubleEvaluation, yIntervalEvaluation);
   }
 }
 
@@ -956,18 +1011,63 @@ void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float
   const float deltaX = pxf - puf;
   const float deltaY = pyf - pvf;
   KDCoordinate circleDiameter = thick ? thickCircleDiameter : thinCircleDiameter;
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
   const float normsRatio = std::sqrt(deltaX*deltaX + deltaY*deltaY) / (circleDiameter / 2.0f);
   const float stepX = deltaX / normsRatio ;
   const float stepY = deltaY / normsRatio;
   const int numberOfStamps = std::floor(normsRatio);
-  for (int i = 0; i < numberOfStamps; i++) {
-    stampAtLocation(ctx, rect, puf, pvf, color, thick);
-    puf += stepX;
-    pvf += stepY;
+  if (numberOfStamps <= 0) {
+    return;
+  }
+  /* Blending the stamps one after the other would pull and push each of them
+   * from the display. Instead, they are composited in a mask covering a
+   * chunk of the segment, whose rows (or columns, for a steep segment) are
+   * then blended span by span. Blending successively two masks m1 and m2 is
+   * the same as blending once the mask m1*m2/255. */
+  constexpr KDCoordinate compositorSize = 32;
+  const bool steep = std::fabs(deltaY) > std::fabs(deltaX);
+  const float maxStep = std::max(std::fabs(stepX), std::fabs(stepY));
+  const int maxNumberOfStampsPerChunk = maxStep > 0.0f ? std::floor((compositorSize - 1 - stampSize) / maxStep) + 1 : numberOfStamps;
+  assert(maxNumberOfStampsPerChunk > 0);
+  uint8_t compositorMask[compositorSize*compositorSize];
+  uint8_t shiftedMask[thickStampSize*thickStampSize];
+  KDColor workingBuffer[compositorSize];
+  int i = 0;
+  while (i < numberOfStamps) {
+    const int chunkEnd = std::min(numberOfStamps, i + maxNumberOfStampsPerChunk);
+    // The stamps origins are monotonous: the chunk ends bound them
+    KDPoint first = ShiftedStamp(puf + i*stepX, pvf + i*stepY, thick, nullptr);
+    KDPoint last = ShiftedStamp(puf + (chunkEnd-1)*stepX, pvf + (chunkEnd-1)*stepY, thick, nullptr);
+    KDRect chunkRect(
+        std::min(first.x(), last.x()),
+        std::min(first.y(), last.y()),
+        std::abs(last.x() - first.x()) + stampSize,
+        std::abs(last.y() - first.y()) + stampSize);
+    assert(chunkRect.width() <= compositorSize && chunkRect.height() <= compositorSize);
+    memset(compositorMask, 0xFF, chunkRect.width()*chunkRect.height());
+    bool chunkIsVisible = false;
+    for (; i < chunkEnd; i++) {
+      KDPoint origin = ShiftedStamp(puf + i*stepX, pvf + i*stepY, thick, shiftedMask);
+      if (!rect.intersects(KDRect(origin, stampSize, stampSize))) {
+        continue;
+      }
+      chunkIsVisible = true;
+      KDCoordinate dx = origin.x() - chunkRect.x();
+      KDCoordinate dy = origin.y() - chunkRect.y();
+      for (int row = 0; row < stampSize; row++) {
+        for (int column = 0; column < stampSize; column++) {
+          uint8_t * m = compositorMask + (dy + row) * chunkRect.width() + dx + column;
+          *m = (*m * shiftedMask[row*stampSize+column]) / 255;
+        }
+      }
+    }
+    if (chunkIsVisible) {
+      ctx->blendSpansWithMask(chunkRect, color, compositorMask, steep, workingBuffer);
+    }
   }
 }
 
-void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const {
+KDPoint CurveView::ShiftedStamp(float pxf, float pyf, bool thick, uint8_t * shiftedMask) {
   /* The (pxf, pyf) coordinates are not generally locating the center of a
    * pixel. We use stampMask, which is one pixel wider and higher than
    * stampSize, in order to cover stampRect without aligning the pixels. Then
@@ -986,12 +1086,9 @@ void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float p
   pyf -= (stampSize + 1 - 1)/2.0f;
   const KDCoordinate px = std::ceil(pxf);
   const KDCoordinate py = std::ceil(pyf);
-  KDRect stampRect(px, py, stampSize, stampSize);
-  if (!rect.intersects(stampRect)) {
-    return;
+  if (shiftedMask == nullptr) {
+    return KDPoint(px, py);
   }
-  uint8_t shiftedMask[stampSize][stampSize];
-  KDColor workingBuffer[stampSize*stampSize];
   const float dx = px - pxf;
   const float dy = py - pyf;
   /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
@@ -1000,11 +1097,24 @@ void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float p
   const KDCoordinate stampMaskSize = stampSize + 1;
   for (int i=0; i<stampSize; i++) {
     for (int j=0; j<stampSize; j++) {
-      shiftedMask[j][i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
+      shiftedMask[j*stampSize+i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
         + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
     }
   }
-  ctx->blendRectWithMask(stampRect, color, (const uint8_t *)shiftedMask, workingBuffer);
+  return KDPoint(px, py);
+}
+
+void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const {
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+  uint8_t shiftedMask[thickStampSize*thickStampSize];
+  KDPoint origin = ShiftedStamp(pxf, pyf, thick, nullptr);
+  KDRect stampRect(origin, stampSize, stampSize);
+  if (!rect.intersects(stampRect)) {
+    return;
+  }
+  ShiftedStamp(pxf, pyf, thick, shiftedMask);
+  KDColor workingBuffer[thickStampSize*thickStampSize];
+  ctx->blendRectWithMask(stampRect, color, shiftedMask, workingBuffer);
 }
 
 void CurveView::layoutSubviews(bool force) {
@@ -30,14 +30,14 @@ public:
   }
 private:
 #ifndef NDEBUG
-  static T * s_global;
+  static ION_THREAD_LOCAL T * s_global;
 #endif
   T * m_rawPointer;
 };
 
 #ifndef NDEBUG
 template<class T>
-T * ExpiringPointer<T>::s_global = nullptr;
+ION_THREAD_LOCAL T * ExpiringPointer<T>::s_global = nullptr;
 #endif
 
 }
@@ -3,7 +3,9 @@
 #include "poincare_helpers.h"
 #include <apps/apps_container.h>
 #include <poincare/horizontal_layout.h>
+#include <poincare/symbol_abstract.h>
 #include <poincare/undefined.h>
+#include <ion/unicode/utf8_helper.h>
 #include <string.h>
 #include <cmath>
 #include <assert.h>
@@ -114,6 +116,45 @@ Layout ExpressionModel::layout(const Storage::Record * record, CodePoint symbol)
   return m_layout;
 }
 
+bool ExpressionModel::dependsOnRecord(const Storage::Record * record, const Storage::Record changedRecord, Poincare::Context * context) const {
+  const char * changedName = changedRecord.fullName();
+  if (changedName == nullptr || record->fullName() == nullptr) {
+    // One of the records has been destroyed
+    return true;
+  }
+  Expression e = expressionClone(record);
+  if (e.isUninitialized()) {
+    return false;
+  }
+  const char * extension = UTF8Helper::CodePointSearch(changedName, Storage::k_dotChar);
+  return ExpressionDependsOnName(e, changedName, extension - changedName, context, k_maxDependencyDepth);
+}
+
+bool ExpressionModel::ExpressionDependsOnName(const Expression e, const char * name, size_t nameLength, Poincare::Context * context, int maxDepth) {
+  ExpressionNode::Type t = e.type();
+  if (t == ExpressionNode::Type::Symbol || t == ExpressionNode::Type::Function || t == ExpressionNode::Type::Sequence) {
+    const SymbolAbstract & symbol = static_cast<const SymbolAbstract &>(e);
+    if (strlen(symbol.name()) == nameLength && strncmp(symbol.name(), name, nameLength) == 0) {
+      return true;
+    }
+    // Sequences values depend on all their terms definitions
+    if (t == ExpressionNode::Type::Sequence || maxDepth == 0) {
+      return true;
+    }
+    Expression definition = context->expressionForSymbolAbstract(symbol, true);
+    if (!definition.isUninitialized() && ExpressionDependsOnName(definition, name, nameLength, context, maxDepth - 1)) {
+      return true;
+    }
+  }
+  const int childrenCount = e.numberOfChildren();
+  for (int i = 0; i < childrenCount; i++) {
+    if (ExpressionDependsOnName(e.childAtIndex(i), name, nameLength, context, maxDepth)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Ion::Storage::Record::ErrorStatus ExpressionModel::setContent(Ion::Storage::Record * record, const char * c, Context * context, CodePoint symbol) {
   Expression e = ExpressionModel::BuildExpressionFromText(c, symbol, context);
   return setExpressionContent(record, e);
@@ -158,6 +199,23 @@ void ExpressionModel::updateNewDataWithExpression(Ion::Storage::Record * record,
   }
 }
 
+size_t ExpressionModel::saveExpressionReduced(void * buffer, size_t bufferSize) const {
+  if (m_expression.isUninitialized()) {
+    return 0;
+  }
+  size_t size = m_expression.size();
+  if (size > bufferSize) {
+    return 0;
+  }
+  memcpy(buffer, m_expression.addressInPool(), size);
+  return size;
+}
+
+void ExpressionModel::restoreExpressionReduced(const void * buffer, size_t size) const {
+  assert(m_expression.isUninitialized());
+  m_expression = Expression::ExpressionFromAddress(buffer, size);
+}
+
 void ExpressionModel::tidy() const {
   m_layout = Layout();
   m_expression = Expression();
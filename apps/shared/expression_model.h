@@ -16,6 +16,9 @@ public:
   Poincare::Expression expressionReduced(const Ion::Storage::Record * record, Poincare::Context * context) const;
   Poincare::Expression expressionClone(const Ion::Storage::Record * record) const;
   Poincare::Layout layout(const Ion::Storage::Record * record, CodePoint symbol = 0) const;
+  /* Returns false only if the expression provably does not refer, even
+   * through other definitions, to the symbol stored in changedRecord. */
+  bool dependsOnRecord(const Ion::Storage::Record * record, const Ion::Storage::Record changedRecord, Poincare::Context * context) const;
 
   // Setters
   Ion::Storage::Record::ErrorStatus setContent(Ion::Storage::Record * record, const char * c, Poincare::Context * context, CodePoint symbol = 0);
@@ -23,6 +26,10 @@ public:
 
   virtual void tidy() const;
   bool hasValidExpression() { return !m_expression.isUninitialized(); }
+  /* The memoized reduced expression can be copied out of the pool before it
+   * is tidied, and memoized again from that copy. */
+  size_t saveExpressionReduced(void * buffer, size_t bufferSize) const;
+  void restoreExpressionReduced(const void * buffer, size_t size) const;
 protected:
   // Setters helper
   static Poincare::Expression BuildExpressionFromText(const char * c, CodePoint symbol = 0, Poincare::Context * context = nullptr);
@@ -33,6 +40,9 @@ private:
   virtual void * expressionAddress(const Ion::Storage::Record * record) const = 0;
   virtual size_t expressionSize(const Ion::Storage::Record * record) const = 0;
   bool isCircularlyDefined(const Ion::Storage::Record * record, Poincare::Context * context) const;
+  static bool ExpressionDependsOnName(const Poincare::Expression e, const char * name, size_t nameLength, Poincare::Context * context, int maxDepth);
+  // Definitions nested deeper are assumed to depend on any record
+  constexpr static int k_maxDependencyDepth = 8;
   mutable int8_t m_circular;
 };
 
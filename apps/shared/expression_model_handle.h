@@ -24,12 +24,17 @@ public:
   virtual bool isDefined();
   virtual bool isEmpty();
   virtual bool shouldBeClearedBeforeRemove() { return !isEmpty(); }
+  /* Memoized models that do not depend on a changed record are kept. By
+   * default, models are assumed to depend on any record. */
+  virtual bool dependsOnRecord(const Ion::Storage::Record changedRecord, Poincare::Context * context) const { return true; }
   /* tidy is responsible to tidy the whole model whereas tidyExpressionModel
    * tidies only the members associated with the ExpressionModel. In
    * ExpressionModel, tidy and tidyExpressionModel trigger the same
    * behaviour but it is not true for its child classes (for example, in
    * Sequence). */
   virtual void tidy() { model()->tidy(); }
+  size_t saveExpressionReduced(void * buffer, size_t bufferSize) const { return model()->saveExpressionReduced(buffer, bufferSize); }
+  void restoreExpressionReduced(const void * buffer, size_t size) { model()->restoreExpressionReduced(buffer, size); }
   virtual Ion::Storage::Record::ErrorStatus setContent(const char * c, Poincare::Context * context) { return editableModel()->setContent(this, c, context, symbol()); }
   Ion::Storage::Record::ErrorStatus setExpressionContent(const Poincare::Expression & e) { return editableModel()->setExpressionContent(this, e); }
 protected:
@@ -1,4 +1,5 @@
 #include "expression_model_store.h"
+#include "global_context.h"
 
 namespace Shared {
 
@@ -40,6 +41,24 @@ void ExpressionModelStore::tidy() {
   resetMemoizedModelsExceptRecord();
 }
 
+void ExpressionModelStore::storageDidChangeForRecord(const Ion::Storage::Record record) const {
+  if (record.isNull()) {
+    resetMemoizedModelsExceptRecord();
+    return;
+  }
+  /* Only forget the memoized models whose expression might refer to the
+   * changed record: editing a variable or a function should not force all the
+   * other models to be reduced again. */
+  GlobalContext context;
+  Ion::Storage::Record emptyRecord;
+  for (int i = 0; i < maxNumberOfMemoizedModels(); i++) {
+    ExpressionModelHandle * model = memoizedModelAtIndex(i);
+    if (!model->isNull() && *model != record && model->dependsOnRecord(record, &context)) {
+      setMemoizedModelAtIndex(i, emptyRecord);
+    }
+  }
+}
+
 int ExpressionModelStore::numberOfModelsSatisfyingTest(ModelTest test, void * context) const {
   int count = 0;
   int index = 0;
@@ -35,7 +35,7 @@ public:
 
   // Other
   virtual void tidy();
-  void storageDidChangeForRecord(const Ion::Storage::Record record) const { resetMemoizedModelsExceptRecord(record); }
+  void storageDidChangeForRecord(const Ion::Storage::Record record) const;
 protected:
   constexpr static int k_maxNumberOfMemoizedModels = 10;
   int maxNumberOfMemoizedModels() const { return maxNumberOfModels() < 0 ? k_maxNumberOfMemoizedModels : maxNumberOfModels(); }
@@ -50,6 +50,7 @@ KDColor Function::color() const {
 
 void Function::setActive(bool active) {
   recordData()->setActive(active);
+  Ion::Storage::sharedStorage()->invalidateChecksum();
   if (!active) {
     didBecomeInactive();
   }
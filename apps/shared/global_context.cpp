@@ -14,7 +14,7 @@ namespace Shared {
 constexpr const char * GlobalContext::k_extensions[];
 
 SequenceStore * GlobalContext::sequenceStore() {
-  static SequenceStore sequenceStore;
+  static ION_THREAD_LOCAL SequenceStore sequenceStore;
   return &sequenceStore;
 }
 
@@ -101,6 +101,7 @@ void Sequence::setType(Type t) {
 
 void Sequence::setInitialRank(int rank) {
   recordData()->setInitialRank(rank);
+  Ion::Storage::sharedStorage()->invalidateChecksum();
   m_firstInitialCondition.tidyName();
   m_secondInitialCondition.tidyName();
 }
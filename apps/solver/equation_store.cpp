@@ -90,29 +90,40 @@ void EquationStore::setIntervalBound(int index, double value) {
 }
 
 void EquationStore::approximateSolve(Poincare::Context * context, bool shouldReplaceFunctionsButNotSymbols) {
+  startApproximateSolve(context, shouldReplaceFunctionsButNotSymbols);
+  while (!approximateSolveStep(context)) {
+  }
+}
+
+void EquationStore::startApproximateSolve(Poincare::Context * context, bool shouldReplaceFunctionsButNotSymbols) {
   m_hasMoreThanMaxNumberOfApproximateSolution = false;
-  Expression undevelopedExpression = modelForRecord(definedRecordAtIndex(0))->standardForm(context, shouldReplaceFunctionsButNotSymbols, ExpressionNode::ReductionTarget::SystemForApproximation);
+  m_approximateSolveExpression = modelForRecord(definedRecordAtIndex(0))->standardForm(context, shouldReplaceFunctionsButNotSymbols, ExpressionNode::ReductionTarget::SystemForApproximation);
   m_userVariablesUsed = !shouldReplaceFunctionsButNotSymbols;
   assert(m_variables[0][0] != 0 && m_variables[1][0] == 0);
   assert(m_type == Type::Monovariable);
   m_numberOfSolutions = 0;
-  double start = m_intervalApproximateSolutions[0];
+}
+
+bool EquationStore::approximateSolveStep(Poincare::Context * context) {
+  assert(!m_approximateSolveExpression.isUninitialized());
+  double start = m_numberOfSolutions == 0 ? m_intervalApproximateSolutions[0] : m_approximateSolutions[m_numberOfSolutions - 1];
   double step = (m_intervalApproximateSolutions[1]-m_intervalApproximateSolutions[0])*k_precision;
-  double root;
-  for (int i = 0; i <= k_maxNumberOfApproximateSolutions; i++) {
-    root = PoincareHelpers::NextRoot(undevelopedExpression, m_variables[0], start, step, m_intervalApproximateSolutions[1], context);
-    if (i == k_maxNumberOfApproximateSolutions) {
-      m_hasMoreThanMaxNumberOfApproximateSolution = !std::isnan(root);
-      break;
-    }
-    m_approximateSolutions[i] = root;
-    if (std::isnan(m_approximateSolutions[i])) {
-      break;
-    } else {
-      start = m_approximateSolutions[i];
-      m_numberOfSolutions++;
-    }
+  double root = PoincareHelpers::NextRoot(m_approximateSolveExpression, m_variables[0], start, step, m_intervalApproximateSolutions[1], context);
+  if (m_numberOfSolutions == k_maxNumberOfApproximateSolutions) {
+    m_hasMoreThanMaxNumberOfApproximateSolution = !std::isnan(root);
+    cancelApproximateSolve();
+    return true;
+  }
+  if (std::isnan(root)) {
+    cancelApproximateSolve();
+    return true;
   }
+  m_approximateSolutions[m_numberOfSolutions++] = root;
+  return false;
+}
+
+void EquationStore::cancelApproximateSolve() {
+  m_approximateSolveExpression = Expression();
 }
 
 EquationStore::Error EquationStore::exactSolve(Poincare::Context * context, bool * replaceFunctionsButNotSymbols) {
@@ -433,6 +444,7 @@ EquationStore::Error EquationStore::oneDimensialPolynomialSolve(Expression exact
 }
 
 void EquationStore::tidySolution() {
+  cancelApproximateSolve();
   for (int i = 0; i < k_maxNumberOfExactSolutions; i++) {
     m_exactSolutionExactLayouts[i] = Layout();
     m_exactSolutionApproximateLayouts[i] = Layout();
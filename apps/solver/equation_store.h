@@ -79,6 +79,11 @@ public:
     return m_approximateSolutions[i];
   }
   void approximateSolve(Poincare::Context * context, bool shouldReplaceFuncionsButNotSymbols);
+  /* The approximate resolution can also be run one root at a time: each step
+   * looks for the next root and returns true once the search is over. */
+  void startApproximateSolve(Poincare::Context * context, bool shouldReplaceFuncionsButNotSymbols);
+  bool approximateSolveStep(Poincare::Context * context);
+  void cancelApproximateSolve();
   bool haveMoreApproximationSolutions() { return m_hasMoreThanMaxNumberOfApproximateSolution; }
 
   void tidy() override;
@@ -116,6 +121,7 @@ private:
   bool m_exactSolutionEquality[k_maxNumberOfExactSolutions];
   double m_intervalApproximateSolutions[2];
   double m_approximateSolutions[k_maxNumberOfApproximateSolutions];
+  Poincare::Expression m_approximateSolveExpression;
   int m_numberOfUserVariables;
   bool m_userVariablesUsed;
 };
@@ -44,6 +44,7 @@ void IntervalController::ContentView::layoutSubviews(bool force) {
 IntervalController::IntervalController(Responder * parentResponder, InputEventHandlerDelegate * inputEventHandlerDelegate, EquationStore * equationStore) :
   FloatParameterController<double>(parentResponder),
   m_contentView(&m_selectableTableView),
+  m_solveTask(this),
   m_intervalCell{},
   m_equationStore(equationStore),
   m_shouldReplaceFunctionsButNotSymbols(false)
@@ -89,6 +90,8 @@ double IntervalController::parameterAtIndex(int index) {
 }
 
 bool IntervalController::setParameterAtIndex(int parameterIndex, double f) {
+  // The roots being searched belong to the former interval
+  TaskScheduler::sharedScheduler()->cancel(&m_solveTask);
   m_equationStore->setIntervalBound(parameterIndex, f);
   return true;
 }
@@ -102,9 +105,30 @@ bool IntervalController::textFieldDidFinishEditing(TextField * textField, const
 }
 
 void IntervalController::buttonAction() {
-  StackViewController * stack = stackController();
-  m_equationStore->approximateSolve(textFieldDelegateApp()->localContext(), m_shouldReplaceFunctionsButNotSymbols);
-  stack->push(App::app()->solutionsControllerStack(), Palette::BannerSecondText, Palette::BannerSecondBackground, Palette::BannerSecondBorder);
+  m_solveTask.start();
+}
+
+void IntervalController::SolveTask::start() {
+  m_controller->m_equationStore->startApproximateSolve(m_controller->textFieldDelegateApp()->localContext(), m_controller->m_shouldReplaceFunctionsButNotSymbols);
+  m_isFinished = false;
+  if (!TaskScheduler::sharedScheduler()->schedule(this)) {
+    // There is no room left for the task: solve at once
+    while (!step()) {
+    }
+  }
+}
+
+bool IntervalController::SolveTask::step() {
+  m_isFinished = m_controller->m_equationStore->approximateSolveStep(m_controller->textFieldDelegateApp()->localContext());
+  if (m_isFinished) {
+    m_controller->stackController()->push(App::app()->solutionsControllerStack(), Palette::BannerSecondText, Palette::BannerSecondBackground, Palette::BannerSecondBorder);
+  }
+  return m_isFinished;
+}
+
+void IntervalController::SolveTask::didCancel() {
+  m_isFinished = true;
+  m_controller->m_equationStore->cancelApproximateSolve();
 }
 
 }
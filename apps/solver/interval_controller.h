@@ -36,7 +36,23 @@ private:
     MessageTextView m_instructions1;
     SelectableTableView * m_selectableTableView;
   };
+  /* The roots are looked for one at a time between events, and the solutions
+   * are displayed once they have all been found. Only leaving the page
+   * cancels the search, other keys are handled while it goes on. */
+  class SolveTask : public Task {
+  public:
+    SolveTask(IntervalController * controller) : Task(Priority::High), m_controller(controller), m_isFinished(true) {}
+    void start();
+    bool step() override;
+    bool isFinished() const override { return m_isFinished; }
+    bool isSupersededBy(Ion::Events::Event event) const override { return event == Ion::Events::Back || event == Ion::Events::Home; }
+    void didCancel() override;
+  private:
+    IntervalController * m_controller;
+    bool m_isFinished;
+  };
   ContentView m_contentView;
+  SolveTask m_solveTask;
   constexpr static int k_maxNumberOfCells = 2;
   MessageTableCellWithEditableText m_intervalCell[k_maxNumberOfCells];
   EquationStore * m_equationStore;
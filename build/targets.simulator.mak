@@ -1 +1,9 @@
 -include build/targets.simulator.$(TARGET).mak
+
+# The test runner and epsilon share their objects, which are rebuilt when
+# switching to a target built with the other kind of singletons.
+ion_singletons_stamp = $(BUILD_DIR)/ion_thread_local_singletons
+ifneq ($(shell cat $(ion_singletons_stamp) 2>/dev/null),$(ION_THREAD_LOCAL_SINGLETONS))
+$(shell mkdir -p $(BUILD_DIR) && echo $(ION_THREAD_LOCAL_SINGLETONS) > $(ion_singletons_stamp))
+endif
+$(all_objs): $(ion_singletons_stamp)
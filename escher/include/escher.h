@@ -56,6 +56,7 @@
 #include <escher/palette.h>
 #include <escher/pointer_text_view.h>
 #include <escher/responder.h>
+#include <escher/row_height_index.h>
 #include <escher/scroll_view.h>
 #include <escher/scroll_view_data_source.h>
 #include <escher/scroll_view_indicator.h>
@@ -81,6 +82,8 @@
 #include <escher/table_cell.h>
 #include <escher/table_view.h>
 #include <escher/table_view_data_source.h>
+#include <escher/task.h>
+#include <escher/task_scheduler.h>
 #include <escher/tiled_view.h>
 #include <escher/timer.h>
 #include <escher/toolbox.h>
@@ -50,6 +50,12 @@ public:
 #endif
     /* tidy clean all dynamically-allocated data */
     virtual void tidy() {}
+    /* Warm resume: before being packed, a snapshot can copy the data it
+     * memoized in the pool to buffer and return the size written, or 0 if it
+     * has nothing worth saving. Once unpacked, restoreWarmState gets the data
+     * back and returns false if it went stale meanwhile. */
+    virtual size_t saveWarmState(void * buffer, size_t bufferSize) { return 0; }
+    virtual bool restoreWarmState(const void * buffer, size_t size) { return false; }
   };
   /* The destructor has to be virtual. Otherwise calling a destructor on an
    * App * pointing to a Derived App would have undefined behaviour. */
@@ -14,6 +14,9 @@
 #include <escher/app.h>
 #include <escher/window.h>
 #include <ion/events.h>
+#if ESCHER_WARM_SNAPSHOTS
+#include <escher/warm_snapshot_store.h>
+#endif
 
 class Container : public RunLoop {
 public:
@@ -33,6 +36,12 @@ public:
   virtual bool switchTo(App::Snapshot * snapshot);
 protected:
   virtual Window * window() = 0;
+  // The snapshot must not be resumed from the data it memoized
+  void discardWarmSnapshot(App::Snapshot * snapshot) {
+#if ESCHER_WARM_SNAPSHOTS
+    m_warmSnapshotStore.discard(snapshot);
+#endif
+  }
   static App * s_activeApp;
 private:
   void step();
@@ -40,6 +49,9 @@ private:
   Timer * timerAtIndex(int i) override;
   virtual int numberOfContainerTimers();
   virtual Timer * containerTimerAtIndex(int i);
+#if ESCHER_WARM_SNAPSHOTS
+  WarmSnapshotStore m_warmSnapshotStore;
+#endif
 };
 
 #endif
@@ -0,0 +1,42 @@
+#ifndef ESCHER_ROW_HEIGHT_INDEX_H
+#define ESCHER_ROW_HEIGHT_INDEX_H
+
+#include <escher/table_view_data_source.h>
+
+/* RowHeightIndex memoizes the cumulated heights of the first rows of a
+ * TableViewDataSource. Once memoized, cumulatedHeightFromIndex is a lookup and
+ * indexFromCumulatedHeight a binary search, instead of a sum over all the
+ * previous rows. Rows beyond the capacity of the index are summed as usual.
+ * The data source owns the index and forwards its cumulatedHeightFromIndex and
+ * indexFromCumulatedHeight to it. It has to call invalidateFromRow(j) whenever
+ * the height of the row j changes, or when rows are inserted or deleted from
+ * the row j onward. */
+
+class RowHeightIndex {
+public:
+  RowHeightIndex(KDCoordinate * cumulatedHeights, int capacity);
+  RowHeightIndex(const RowHeightIndex & other) = delete;
+  RowHeightIndex & operator=(const RowHeightIndex & other) = delete;
+  void invalidateFromRow(int j);
+  void invalidate() { invalidateFromRow(0); }
+  int numberOfMemoizedRows() const { return m_numberOfMemoizedRows; }
+  KDCoordinate cumulatedHeightFromIndex(TableViewDataSource * dataSource, int j);
+  int indexFromCumulatedHeight(TableViewDataSource * dataSource, KDCoordinate offsetY);
+private:
+  void memoizeRows(TableViewDataSource * dataSource, int numberOfRows);
+  /* m_cumulatedHeights[k] is the height of the rows 0 to k included. Only the
+   * first m_numberOfMemoizedRows values are valid. */
+  KDCoordinate * m_cumulatedHeights;
+  int m_capacity;
+  int m_numberOfMemoizedRows;
+};
+
+template<int N>
+class MemoizedRowHeightIndex : public RowHeightIndex {
+public:
+  MemoizedRowHeightIndex() : RowHeightIndex(m_buffer, N), m_buffer{} {}
+private:
+  KDCoordinate m_buffer[N];
+};
+
+#endif
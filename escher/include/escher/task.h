@@ -0,0 +1,31 @@
+#ifndef ESCHER_TASK_H
+#define ESCHER_TASK_H
+
+#include <ion/events.h>
+#include <stdint.h>
+
+/* A Task is a long computation split into short steps. Once scheduled, its
+ * steps are performed by the run loop while no event is pending, so that the
+ * user can keep interacting with the calculator in between. */
+
+class Task {
+public:
+  enum class Priority : uint8_t {
+    Low, // Rendering, sweeps...
+    High // Feedback to the user's last action
+  };
+  Task(Priority priority = Priority::Low) : m_priority(priority) {}
+  Priority priority() const { return m_priority; }
+  /* Perform a unit of work short enough not to delay the next event and
+   * return true if the window needs to be redrawn. */
+  virtual bool step() = 0;
+  virtual bool isFinished() const = 0;
+  // Whether handling the event makes the remaining work obsolete
+  virtual bool isSupersededBy(Ion::Events::Event event) const { return event.isKeyboardEvent(); }
+  // Called when the task is unscheduled before being finished
+  virtual void didCancel() {}
+private:
+  Priority m_priority;
+};
+
+#endif
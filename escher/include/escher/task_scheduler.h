@@ -0,0 +1,33 @@
+#ifndef ESCHER_TASK_SCHEDULER_H
+#define ESCHER_TASK_SCHEDULER_H
+
+#include <escher/task.h>
+
+/* The TaskScheduler holds the tasks waiting for idle time. The run loop asks
+ * it for steps, highest priority first and in order of scheduling within a
+ * priority, for at most SliceDuration before checking for events again. */
+
+class TaskScheduler {
+public:
+  static constexpr int SliceDuration = 30; // In milliseconds
+  static TaskScheduler * sharedScheduler();
+  TaskScheduler() : m_numberOfTasks(0) {}
+  bool hasPendingTasks() const { return m_numberOfTasks > 0; }
+  bool isScheduled(const Task * task) const { return indexOfTask(task) >= 0; }
+  // Return false if there is no room left for the task
+  bool schedule(Task * task);
+  void cancel(Task * task);
+  void cancelAll();
+  void cancelTasksSupersededBy(Ion::Events::Event event);
+  /* Perform a step of the most urgent task and return true if the window needs
+   * to be redrawn. */
+  bool step();
+private:
+  static constexpr int k_maxNumberOfTasks = 4;
+  int indexOfTask(const Task * task) const;
+  void removeTaskAtIndex(int index);
+  Task * m_tasks[k_maxNumberOfTasks];
+  int m_numberOfTasks;
+};
+
+#endif
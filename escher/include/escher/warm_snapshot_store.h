@@ -0,0 +1,45 @@
+#ifndef ESCHER_WARM_SNAPSHOT_STORE_H
+#define ESCHER_WARM_SNAPSHOT_STORE_H
+
+#include <escher/app.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* WarmSnapshotStore keeps, for the snapshots of the apps that were left, the
+ * data they memoized. When such an app is reopened and its data is still
+ * valid, it resumes from it instead of computing it again. Only the Graph app
+ * saves such data for now: the reduced expressions of its memoized functions
+ * and the caches they used. The last frame is not kept.
+ *
+ * The entries are stored one after the other in a fixed arena, the oldest
+ * first, and the oldest ones are evicted when a new entry needs room. */
+
+class WarmSnapshotStore {
+public:
+  WarmSnapshotStore() : m_usedSize(0) {}
+  void save(App::Snapshot * snapshot);
+  bool restore(App::Snapshot * snapshot);
+  void discard(App::Snapshot * snapshot);
+private:
+  struct EntryHeader {
+    App::Snapshot * snapshot;
+    uint32_t stateSize;
+    size_t size() const { return sizeof(EntryHeader) + stateSize; }
+  };
+  /* The arena is always allocated, so it is kept small. The reduced
+   * expressions of usual functions take a few dozen bytes each. A function
+   * whose expression does not fit is saved without it, and its expression is
+   * reduced again when the app is reopened. */
+  constexpr static size_t k_arenaSize = 4 * 1024;
+  // A new entry evicts the oldest ones until this much of the arena is free
+  constexpr static size_t k_minimalFreeSize = k_arenaSize / 2;
+  constexpr static size_t k_alignment = alignof(EntryHeader);
+  static size_t Aligned(size_t size) { return (size + k_alignment - 1) & ~(k_alignment - 1); }
+  EntryHeader * entryAt(size_t offset) { return reinterpret_cast<EntryHeader *>(m_arena + offset); }
+  EntryHeader * entryForSnapshot(App::Snapshot * snapshot, size_t * offset);
+  void removeEntryAt(size_t offset);
+  alignas(k_alignment) char m_arena[k_arenaSize];
+  size_t m_usedSize;
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include <escher/container.h>
+#include <escher/task_scheduler.h>
 #include <assert.h>
 
 Container::Container() :
@@ -25,6 +26,12 @@ bool Container::switchTo(App::Snapshot * snapshot) {
     return false;
   }
   if (s_activeApp) {
+    // The pending tasks belong to the app and must not outlive it
+    TaskScheduler::sharedScheduler()->cancelAll();
+#if ESCHER_WARM_SNAPSHOTS
+    // The pool still holds what the app memoized
+    m_warmSnapshotStore.save(s_activeApp->snapshot());
+#endif
     s_activeApp->willBecomeInactive();
     s_activeApp->snapshot()->pack(s_activeApp);
     s_activeApp = nullptr;
@@ -33,6 +40,9 @@ bool Container::switchTo(App::Snapshot * snapshot) {
     s_activeApp = snapshot->unpack(this);
   }
   if (s_activeApp) {
+#if ESCHER_WARM_SNAPSHOTS
+    m_warmSnapshotStore.restore(s_activeApp->snapshot());
+#endif
     s_activeApp->didBecomeActive(window());
     window()->redraw();
   }
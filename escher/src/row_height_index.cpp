@@ -0,0 +1,77 @@
+#include <escher/row_height_index.h>
+#include <assert.h>
+
+RowHeightIndex::RowHeightIndex(KDCoordinate * cumulatedHeights, int capacity) :
+  m_cumulatedHeights(cumulatedHeights),
+  m_capacity(capacity),
+  m_numberOfMemoizedRows(0)
+{
+  assert(capacity > 0);
+}
+
+void RowHeightIndex::invalidateFromRow(int j) {
+  if (j < 0) {
+    j = 0;
+  }
+  if (j < m_numberOfMemoizedRows) {
+    m_numberOfMemoizedRows = j;
+  }
+}
+
+void RowHeightIndex::memoizeRows(TableViewDataSource * dataSource, int numberOfRows) {
+  if (numberOfRows > m_capacity) {
+    numberOfRows = m_capacity;
+  }
+  KDCoordinate cumulatedHeight = m_numberOfMemoizedRows == 0 ? 0 : m_cumulatedHeights[m_numberOfMemoizedRows - 1];
+  while (m_numberOfMemoizedRows < numberOfRows) {
+    cumulatedHeight += dataSource->rowHeight(m_numberOfMemoizedRows);
+    m_cumulatedHeights[m_numberOfMemoizedRows++] = cumulatedHeight;
+  }
+}
+
+KDCoordinate RowHeightIndex::cumulatedHeightFromIndex(TableViewDataSource * dataSource, int j) {
+  if (j <= 0) {
+    return 0;
+  }
+  memoizeRows(dataSource, j);
+  int k = j < m_numberOfMemoizedRows ? j : m_numberOfMemoizedRows;
+  KDCoordinate result = m_cumulatedHeights[k - 1];
+  while (k < j) {
+    result += dataSource->rowHeight(k++);
+  }
+  return result;
+}
+
+int RowHeightIndex::indexFromCumulatedHeight(TableViewDataSource * dataSource, KDCoordinate offsetY) {
+  /* This returns the same index as TableViewDataSource::indexFromCumulatedHeight:
+   * find the first row j such that the height of the rows 0 to j-1 is greater
+   * or equal to offsetY. */
+  int numberOfRows = dataSource->numberOfRows();
+  memoizeRows(dataSource, numberOfRows);
+  int j = 0;
+  KDCoordinate cumulatedHeight = 0;
+  int n = numberOfRows < m_numberOfMemoizedRows ? numberOfRows : m_numberOfMemoizedRows;
+  if (offsetY > 0 && n > 0) {
+    if (m_cumulatedHeights[n - 1] < offsetY) {
+      j = n;
+    } else {
+      // Find the first k such that m_cumulatedHeights[k] >= offsetY
+      int min = 0;
+      int max = n - 1;
+      while (min < max) {
+        int middle = (min + max) / 2;
+        if (m_cumulatedHeights[middle] < offsetY) {
+          min = middle + 1;
+        } else {
+          max = middle;
+        }
+      }
+      j = min + 1;
+    }
+    cumulatedHeight = m_cumulatedHeights[j - 1];
+  }
+  while (cumulatedHeight < offsetY && j < numberOfRows) {
+    cumulatedHeight += dataSource->rowHeight(j++);
+  }
+  return (cumulatedHeight < offsetY || offsetY == 0) ? j : j - 1;
+}
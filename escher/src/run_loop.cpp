@@ -1,4 +1,5 @@
 #include <escher/run_loop.h>
+#include <escher/task_scheduler.h>
 #include <kandinsky/font.h>
 #include <assert.h>
 
@@ -25,8 +26,12 @@ void RunLoop::runWhile(bool (*callback)(void * ctx), void * ctx) {
 }
 
 bool RunLoop::step() {
-  // Fetch the event, if any
-  int eventDuration = Timer::TickDuration;
+  TaskScheduler * scheduler = TaskScheduler::sharedScheduler();
+  /* Fetch the event, if any. While tasks are pending and no key is down, the
+   * keyboard is only polled so that idle time is spent on them. A held key
+   * gets a regular timeout, so that it repeats as usual. */
+  bool poll = scheduler->hasPendingTasks() && Ion::Keyboard::scan() == 0;
+  int eventDuration = poll ? 0 : Timer::TickDuration;
   int timeout = eventDuration;
 
   Ion::Events::Event event = Ion::Events::getEvent(&timeout);
@@ -43,6 +48,18 @@ bool RunLoop::step() {
 
   m_time += eventDuration;
 
+  if (event == Ion::Events::None && scheduler->hasPendingTasks()) {
+    uint64_t sliceStart = Ion::Timing::millis();
+    uint64_t sliceDuration;
+    do {
+      if (scheduler->step()) {
+        dispatchEvent(Ion::Events::TimerFire);
+      }
+      sliceDuration = Ion::Timing::millis() - sliceStart;
+    } while (scheduler->hasPendingTasks() && sliceDuration < TaskScheduler::SliceDuration);
+    m_time += sliceDuration;
+  }
+
   if (m_time >= Timer::TickDuration) {
     m_time -= Timer::TickDuration;
     for (int i=0; i<numberOfTimers(); i++) {
@@ -70,6 +87,7 @@ bool RunLoop::step() {
       return true;
     }
 #endif
+    scheduler->cancelTasksSupersededBy(event);
     dispatchEvent(event);
   }
 
@@ -0,0 +1,86 @@
+#include <escher/task_scheduler.h>
+#include <assert.h>
+
+static TaskScheduler s_taskScheduler;
+
+TaskScheduler * TaskScheduler::sharedScheduler() {
+  return &s_taskScheduler;
+}
+
+bool TaskScheduler::schedule(Task * task) {
+  assert(task != nullptr);
+  if (isScheduled(task)) {
+    return true;
+  }
+  if (m_numberOfTasks == k_maxNumberOfTasks) {
+    return false;
+  }
+  m_tasks[m_numberOfTasks++] = task;
+  return true;
+}
+
+void TaskScheduler::cancel(Task * task) {
+  int index = indexOfTask(task);
+  if (index >= 0) {
+    removeTaskAtIndex(index);
+    task->didCancel();
+  }
+}
+
+void TaskScheduler::cancelAll() {
+  while (m_numberOfTasks > 0) {
+    cancel(m_tasks[m_numberOfTasks - 1]);
+  }
+}
+
+void TaskScheduler::cancelTasksSupersededBy(Ion::Events::Event event) {
+  int i = 0;
+  while (i < m_numberOfTasks) {
+    Task * task = m_tasks[i];
+    if (task->isSupersededBy(event)) {
+      cancel(task);
+    } else {
+      i++;
+    }
+  }
+}
+
+bool TaskScheduler::step() {
+  if (m_numberOfTasks == 0) {
+    return false;
+  }
+  int index = 0;
+  for (int i = 1; i < m_numberOfTasks; i++) {
+    if (m_tasks[i]->priority() > m_tasks[index]->priority()) {
+      index = i;
+    }
+  }
+  Task * task = m_tasks[index];
+  bool needsRedraw = task->step();
+  /* The step may have scheduled or cancelled tasks, so the index of the task
+   * has to be looked up again. */
+  if (task->isFinished()) {
+    index = indexOfTask(task);
+    if (index >= 0) {
+      removeTaskAtIndex(index);
+    }
+  }
+  return needsRedraw;
+}
+
+int TaskScheduler::indexOfTask(const Task * task) const {
+  for (int i = 0; i < m_numberOfTasks; i++) {
+    if (m_tasks[i] == task) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void TaskScheduler::removeTaskAtIndex(int index) {
+  assert(index >= 0 && index < m_numberOfTasks);
+  m_numberOfTasks--;
+  for (int i = index; i < m_numberOfTasks; i++) {
+    m_tasks[i] = m_tasks[i + 1];
+  }
+}
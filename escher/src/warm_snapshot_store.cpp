@@ -0,0 +1,57 @@
+#include <escher/warm_snapshot_store.h>
+#include <string.h>
+#include <assert.h>
+
+void WarmSnapshotStore::save(App::Snapshot * snapshot) {
+  discard(snapshot);
+  while (m_usedSize > 0 && k_arenaSize - m_usedSize < k_minimalFreeSize) {
+    removeEntryAt(0);
+  }
+  EntryHeader * header = entryAt(m_usedSize);
+  char * state = reinterpret_cast<char *>(header + 1);
+  size_t availableSize = k_arenaSize - m_usedSize - sizeof(EntryHeader);
+  size_t stateSize = Aligned(snapshot->saveWarmState(state, availableSize));
+  if (stateSize == 0 || stateSize > availableSize) {
+    return;
+  }
+  header->snapshot = snapshot;
+  header->stateSize = stateSize;
+  m_usedSize += header->size();
+}
+
+bool WarmSnapshotStore::restore(App::Snapshot * snapshot) {
+  size_t offset;
+  EntryHeader * header = entryForSnapshot(snapshot, &offset);
+  if (header == nullptr) {
+    return false;
+  }
+  const char * state = reinterpret_cast<const char *>(header + 1);
+  bool restored = snapshot->restoreWarmState(state, header->stateSize);
+  // The entry is saved again when the app is left
+  removeEntryAt(offset);
+  return restored;
+}
+
+void WarmSnapshotStore::discard(App::Snapshot * snapshot) {
+  size_t offset;
+  if (entryForSnapshot(snapshot, &offset) != nullptr) {
+    removeEntryAt(offset);
+  }
+}
+
+WarmSnapshotStore::EntryHeader * WarmSnapshotStore::entryForSnapshot(App::Snapshot * snapshot, size_t * offset) {
+  for (size_t o = 0; o < m_usedSize; o += entryAt(o)->size()) {
+    if (entryAt(o)->snapshot == snapshot) {
+      *offset = o;
+      return entryAt(o);
+    }
+  }
+  return nullptr;
+}
+
+void WarmSnapshotStore::removeEntryAt(size_t offset) {
+  assert(offset < m_usedSize);
+  size_t size = entryAt(offset)->size();
+  memmove(m_arena + offset, m_arena + offset + size, m_usedSize - offset - size);
+  m_usedSize -= size;
+}
@@ -0,0 +1,58 @@
+#include <quiz.h>
+#include <escher/row_height_index.h>
+
+class VariableHeightDataSource : public TableViewDataSource {
+public:
+  VariableHeightDataSource(int numberOfRows) : m_numberOfRows(numberOfRows), m_numberOfRowHeightCalls(0) {}
+  int numberOfRows() const override { return m_numberOfRows; }
+  int numberOfColumns() const override { return 1; }
+  KDCoordinate columnWidth(int i) override { return 100; }
+  KDCoordinate rowHeight(int j) override {
+    m_numberOfRowHeightCalls++;
+    return j < m_numberOfRows ? (j % 3 == 1 ? 0 : 10 + j % 7) : 0;
+  }
+  HighlightCell * reusableCell(int index, int type) override { return nullptr; }
+  int reusableCellCount(int type) override { return 0; }
+  int typeAtLocation(int i, int j) override { return 0; }
+  void setNumberOfRows(int numberOfRows) { m_numberOfRows = numberOfRows; }
+  int numberOfRowHeightCalls() const { return m_numberOfRowHeightCalls; }
+private:
+  int m_numberOfRows;
+  int m_numberOfRowHeightCalls;
+};
+
+void assert_index_matches_data_source(RowHeightIndex * index, VariableHeightDataSource * dataSource) {
+  int numberOfRows = dataSource->numberOfRows();
+  for (int j = 0; j <= numberOfRows + 1; j++) {
+    quiz_assert(index->cumulatedHeightFromIndex(dataSource, j) == dataSource->TableViewDataSource::cumulatedHeightFromIndex(j));
+  }
+  KDCoordinate totalHeight = dataSource->TableViewDataSource::cumulatedHeightFromIndex(numberOfRows);
+  for (KDCoordinate offsetY = -1; offsetY <= totalHeight + 2; offsetY++) {
+    quiz_assert(index->indexFromCumulatedHeight(dataSource, offsetY) == dataSource->TableViewDataSource::indexFromCumulatedHeight(offsetY));
+  }
+}
+
+QUIZ_CASE(escher_row_height_index) {
+  VariableHeightDataSource dataSource(50);
+  // Rows beyond the capacity are summed
+  MemoizedRowHeightIndex<20> smallIndex;
+  assert_index_matches_data_source(&smallIndex, &dataSource);
+  MemoizedRowHeightIndex<64> index;
+  assert_index_matches_data_source(&index, &dataSource);
+
+  // Memoized heights are not computed again
+  int numberOfCalls = dataSource.numberOfRowHeightCalls();
+  index.cumulatedHeightFromIndex(&dataSource, 50);
+  index.indexFromCumulatedHeight(&dataSource, 300);
+  quiz_assert(dataSource.numberOfRowHeightCalls() == numberOfCalls);
+
+  // Invalidation only forgets the following rows
+  dataSource.setNumberOfRows(30);
+  index.invalidateFromRow(30);
+  quiz_assert(index.numberOfMemoizedRows() == 30);
+  assert_index_matches_data_source(&index, &dataSource);
+  index.invalidate();
+  quiz_assert(index.numberOfMemoizedRows() == 0);
+  dataSource.setNumberOfRows(0);
+  assert_index_matches_data_source(&index, &dataSource);
+}
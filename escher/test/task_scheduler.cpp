@@ -0,0 +1,76 @@
+#include <quiz.h>
+#include <escher/task_scheduler.h>
+
+class CountingTask : public Task {
+public:
+  CountingTask(int numberOfSteps, Priority priority = Priority::Low, int * log = nullptr, int id = 0) :
+    Task(priority),
+    m_numberOfSteps(numberOfSteps),
+    m_numberOfCancellations(0),
+    m_log(log),
+    m_id(id)
+  {}
+  bool step() override {
+    m_numberOfSteps--;
+    if (m_log) {
+      *m_log = *m_log * 10 + m_id;
+    }
+    return m_numberOfSteps % 2 == 0;
+  }
+  bool isFinished() const override { return m_numberOfSteps == 0; }
+  void didCancel() override { m_numberOfCancellations++; }
+  int numberOfSteps() const { return m_numberOfSteps; }
+  int numberOfCancellations() const { return m_numberOfCancellations; }
+private:
+  int m_numberOfSteps;
+  int m_numberOfCancellations;
+  int * m_log;
+  int m_id;
+};
+
+QUIZ_CASE(escher_task_scheduler_steps_tasks_by_priority) {
+  TaskScheduler scheduler;
+  int log = 0;
+  CountingTask first(2, Task::Priority::Low, &log, 1);
+  CountingTask second(1, Task::Priority::Low, &log, 2);
+  CountingTask urgent(2, Task::Priority::High, &log, 3);
+  quiz_assert(!scheduler.hasPendingTasks());
+  quiz_assert(scheduler.schedule(&first));
+  quiz_assert(scheduler.schedule(&second));
+  quiz_assert(scheduler.schedule(&urgent));
+  // Scheduling a task twice does not duplicate it
+  quiz_assert(scheduler.schedule(&urgent));
+  int numberOfRedraws = 0;
+  while (scheduler.hasPendingTasks()) {
+    numberOfRedraws += scheduler.step();
+  }
+  quiz_assert(log == 33112);
+  quiz_assert(numberOfRedraws == 3);
+  quiz_assert(first.numberOfCancellations() == 0);
+}
+
+QUIZ_CASE(escher_task_scheduler_cancels_tasks) {
+  TaskScheduler scheduler;
+  CountingTask tasks[5] = {CountingTask(3), CountingTask(3), CountingTask(3), CountingTask(3), CountingTask(3)};
+  for (int i = 0; i < 4; i++) {
+    quiz_assert(scheduler.schedule(tasks + i));
+  }
+  // The scheduler is full
+  quiz_assert(!scheduler.schedule(tasks + 4));
+  scheduler.cancel(tasks + 1);
+  quiz_assert(!scheduler.isScheduled(tasks + 1));
+  quiz_assert(tasks[1].numberOfCancellations() == 1);
+  // Cancelling a task which is not scheduled does nothing
+  scheduler.cancel(tasks + 1);
+  quiz_assert(tasks[1].numberOfCancellations() == 1);
+  // A keyboard event supersedes the tasks by default
+  scheduler.cancelTasksSupersededBy(Ion::Events::None);
+  quiz_assert(scheduler.isScheduled(tasks));
+  scheduler.cancelTasksSupersededBy(Ion::Events::OK);
+  quiz_assert(!scheduler.hasPendingTasks());
+  quiz_assert(tasks[0].numberOfCancellations() == 1 && tasks[3].numberOfCancellations() == 1);
+  quiz_assert(tasks[0].numberOfSteps() == 3);
+  scheduler.schedule(tasks + 4);
+  scheduler.cancelAll();
+  quiz_assert(!scheduler.hasPendingTasks() && tasks[4].numberOfCancellations() == 1);
+}
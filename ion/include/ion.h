@@ -13,7 +13,9 @@
 #include <ion/led.h>
 #include <ion/power.h>
 #include <ion/rtc.h>
+#include <ion/state.h>
 #include <ion/storage.h>
+#include <ion/thread_local.h>
 #include <ion/timing.h>
 #include <ion/usb.h>
 #include <ion/unicode/utf8_decoder.h>
@@ -62,6 +64,13 @@ bool stackSafe();
 // Collect registers in a buffer and returns the stack pointer
 uintptr_t collectRegisters(jmp_buf regs);
 
+/* Allows code written in the given region of RAM to be run. The whole memory
+ * pages holding the region may become executable. Returns false if the
+ * platform cannot run code from RAM. */
+bool makeExecutable(void * start, size_t length);
+// Makes instructions just written in RAM visible to the instruction fetch
+void synchronizeInstructionCache(void * start, size_t length);
+
 }
 
 #endif
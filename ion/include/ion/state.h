@@ -0,0 +1,30 @@
+#ifndef ION_STATE_H
+#define ION_STATE_H
+
+#if ION_SIMULATOR_FILES
+
+namespace Ion {
+namespace State {
+
+/* The simulator can save a snapshot of a session and restore it without
+ * replaying its whole events history. Ion serializes the Storage by itself and
+ * relies on a delegate for the state it does not own, such as the preferences
+ * or the active app. */
+
+class Delegate {
+public:
+  // Returns the number of bytes written, or -1 if the buffer is too small
+  virtual int serializeState(char * buffer, int bufferSize) = 0;
+  virtual bool restoreState(const char * buffer, int bufferSize) = 0;
+};
+
+/* If a snapshot has been loaded before the delegate is set, its state is
+ * restored right away. */
+void setDelegate(Delegate * delegate);
+
+}
+}
+
+#endif
+
+#endif
@@ -93,7 +93,11 @@ public:
   size_t availableSize();
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
+  /* The checksum is memoized until the storage notifies a change. Records
+   * edited in place through the buffer returned by value() must invalidate it
+   * themselves. */
   uint32_t checksum();
+  void invalidateChecksum() const { m_checksumIsValid = false; }
 
   // Delegate
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
@@ -186,6 +190,8 @@ private:
   StorageDelegate * m_delegate;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  uint32_t m_checksum;
+  mutable bool m_checksumIsValid;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
@@ -0,0 +1,15 @@
+#ifndef ION_THREAD_LOCAL_H
+#define ION_THREAD_LOCAL_H
+
+/* Host builds may run several test cases concurrently, each worker thread
+ * having its own tree pool, storage and preferences. The singletons holding
+ * such state are declared ION_THREAD_LOCAL, which expands to nothing on
+ * platforms that only ever run a single thread. */
+
+#if ION_THREAD_LOCAL_SINGLETONS
+#define ION_THREAD_LOCAL thread_local
+#else
+#define ION_THREAD_LOCAL
+#endif
+
+#endif
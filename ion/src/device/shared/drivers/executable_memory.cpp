@@ -0,0 +1,14 @@
+#include <ion.h>
+#include <drivers/cache.h>
+
+/* The MPU regions set by the boards have not been checked to allow running
+ * code from the SRAM, so code in RAM is not run on the device. */
+
+bool Ion::makeExecutable(void * start, size_t length) {
+  return false;
+}
+
+void Ion::synchronizeInstructionCache(void * start, size_t length) {
+  Ion::Device::Cache::cleanDCache();
+  Ion::Device::Cache::invalidateICache();
+}
@@ -0,0 +1,8 @@
+#include <ion.h>
+
+bool Ion::makeExecutable(void * start, size_t length) {
+  return false;
+}
+
+void Ion::synchronizeInstructionCache(void * start, size_t length) {
+}
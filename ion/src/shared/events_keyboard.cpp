@@ -54,11 +54,19 @@ static Keyboard::Key keyFromState(Keyboard::State state) {
   return static_cast<Keyboard::Key>(63 - __builtin_clzll(state));
 }
 
+/* A zero timeout polls the keyboard once: it can report a platform event or a
+ * key press, but never a repetition, which needs a timeout longer than the
+ * repetition delays. The keys seen up by polls are kept until the next event,
+ * so that a key pressed between two polls is still reported. */
+static uint64_t sKeysSeenUpByPolls = 0;
+
 static inline Event innerGetEvent(int * timeout) {
-  assert(*timeout > delayBeforeRepeat);
-  assert(*timeout > delayBetweenRepeat);
+  assert(*timeout == 0 || *timeout > delayBeforeRepeat);
+  assert(*timeout == 0 || *timeout > delayBetweenRepeat);
+  bool isPoll = *timeout == 0;
   int time = 0;
-  uint64_t keysSeenUp = 0;
+  uint64_t keysSeenUp = sKeysSeenUpByPolls;
+  sKeysSeenUpByPolls = 0;
   uint64_t keysSeenTransitionningFromUpToDown = 0;
   while (true) {
     Event platformEvent = getPlatformEvent();
@@ -110,6 +118,9 @@ static inline Event innerGetEvent(int * timeout) {
     if (sleepWithTimeout(10, timeout)) {
       // Timeout occurred
       resetLongRepetition();
+      if (isPoll) {
+        sKeysSeenUpByPolls = keysSeenUp;
+      }
       return Events::None;
     }
     time += 10;
@@ -2,6 +2,9 @@
 #include <string.h>
 #include <assert.h>
 #include <new>
+#if ION_THREAD_LOCAL_SINGLETONS
+#include <atomic>
+#endif
 #if ION_STORAGE_LOG
 #include<iostream>
 #endif
@@ -28,7 +31,15 @@ constexpr char Storage::seqExtension[];
 constexpr char Storage::eqExtension[];
 
 Storage * Storage::sharedStorage() {
+#if ION_THREAD_LOCAL_SINGLETONS
+  /* The first thread to use the storage gets the one advertised in the
+   * PlatformInfo, other threads get their own. */
+  static std::atomic<bool> staticStorageAreaIsUsed(false);
+  alignas(Storage) static thread_local uint32_t threadStorageArea[sizeof(Storage)/sizeof(uint32_t)];
+  static thread_local Storage * storage = new (staticStorageAreaIsUsed.exchange(true) ? threadStorageArea : staticStorageArea) Storage();
+#else
   static Storage * storage = new (staticStorageArea) Storage();
+#endif
   return storage;
 }
 
@@ -113,6 +124,7 @@ size_t Storage::putAvailableSpaceAtEndOfRecord(Storage::Record r) {
       (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
+  invalidateChecksum();
   return newRecordSize;
 }
 
@@ -124,13 +136,19 @@ void Storage::getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableS
       nextRecord,
       m_buffer + k_storageSize - nextRecord);
   overrideSizeAtPosition(p, (record_size_t)(previousRecordSize - recordAvailableSpace));
+  invalidateChecksum();
 }
 
 uint32_t Storage::checksum() {
-  return Ion::crc32Byte((const uint8_t *) m_buffer, endBuffer()-m_buffer);
+  if (!m_checksumIsValid) {
+    m_checksum = Ion::crc32Byte((const uint8_t *) m_buffer, endBuffer()-m_buffer);
+    m_checksumIsValid = true;
+  }
+  return m_checksum;
 }
 
 void Storage::notifyChangeToDelegate(const Record record) const {
+  invalidateChecksum();
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
   if (m_delegate != nullptr) {
@@ -328,7 +346,9 @@ Storage::Storage() :
   m_magicFooter(Magic),
   m_delegate(nullptr),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_checksum(0),
+  m_checksumIsValid(false)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
@@ -362,7 +382,9 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
     }
     overrideSizeAtPosition(p, newRecordSize);
     overrideFullNameAtPosition(p+sizeof(record_size_t), fullName);
-    notifyChangeToDelegate(record);
+    /* Records referring to the previous name might be impacted as well, so the
+     * delegate is not given the renamed record. */
+    notifyChangeToDelegate();
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
@@ -388,7 +410,8 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
     overrideBaseNameWithExtensionAtPosition(fullNamePosition, baseName, extension);
     // Recompute the CRC32
     record = Record(fullNamePosition);
-    notifyChangeToDelegate(record);
+    // See comment in setFullNameOfRecord
+    notifyChangeToDelegate();
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
     return Record::ErrorStatus::None;
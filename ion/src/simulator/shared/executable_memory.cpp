@@ -0,0 +1,23 @@
+#include <ion.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+bool Ion::makeExecutable(void * start, size_t length) {
+#if defined(__linux__)
+  // mprotect works on whole pages
+  uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  uintptr_t firstPage = reinterpret_cast<uintptr_t>(start) & ~(pageSize - 1);
+  uintptr_t end = (reinterpret_cast<uintptr_t>(start) + length + pageSize - 1) & ~(pageSize - 1);
+  return mprotect(reinterpret_cast<void *>(firstPage), end - firstPage, PROT_READ | PROT_WRITE | PROT_EXEC) == 0;
+#else
+  return false;
+#endif
+}
+
+void Ion::synchronizeInstructionCache(void * start, size_t length) {
+#if defined(__linux__)
+  __builtin___clear_cache(static_cast<char *>(start), static_cast<char *>(start) + length);
+#endif
+}
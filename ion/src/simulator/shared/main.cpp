@@ -76,12 +76,12 @@ int main(int argc, char * argv[]) {
   bool help = args.popFlag("--help") || args.popFlag("-h");
   bool headless = args.popFlag("--headless");
   bool volatile_storage = args.popFlag("--volatile") || args.popFlag("-v");
+  bool restored_storage = false;
 
 #if ION_SIMULATOR_FILES
   const char * stateFile = args.pop("--load-state-file");
-  if (stateFile) {
-    StateFile::load(stateFile);
-  }
+  // A snapshot already contains the python scripts
+  restored_storage = stateFile && StateFile::load(stateFile);
 #endif
 
   if (help) {
@@ -91,6 +91,9 @@ int main(int argc, char * argv[]) {
     std::cout << "  -s, --screen-only         Disable the keyboard." << std::endl;
     std::cout << "  -v, --volatile            Disable saving and loading python scripts from file." << std::endl;
     std::cout << "  -u, --unresizable         Disable resizing the window." << std::endl;
+#if ION_SIMULATOR_FILES
+    std::cout << "  --record-journal          Save states as events journals instead of snapshots." << std::endl;
+#endif
     std::cout << "  -h, --help                Show this help menu." << std::endl;
     return 0;
   }
@@ -100,14 +103,22 @@ int main(int argc, char * argv[]) {
     bool screen_only = args.popFlag("--screen-only") || args.popFlag("-s");
     bool fullscreen =  args.popFlag("--fullscreen")  || args.popFlag("-f");
     bool unresizable = args.popFlag("--unresizable") || args.popFlag("-u");
+#if ION_SIMULATOR_FILES
+    /* States are saved as snapshots, the events are only logged when they are
+     * to be saved in a journal. */
+    if (args.popFlag("--record-journal")) {
+      StateFile::recordJournal();
+    }
+#else
     Journal::init();
+#endif
 #if EPSILON_TELEMETRY
     Telemetry::init();
 #endif
     Window::init(screen_only, fullscreen, unresizable);
     Haptics::init();
   }
-  if (!volatile_storage) {
+  if (!volatile_storage && !restored_storage) {
     Ion::Simulator::StoreScript::loadPython(&args);
   }
   ion_main(args.argc(), args.argv());
@@ -119,7 +130,9 @@ int main(int argc, char * argv[]) {
 #endif
   }
 
-  if (!volatile_storage) {
+  /* The scripts of a snapshot must not replace the ones saved by the user's
+   * own sessions. */
+  if (!volatile_storage && !restored_storage) {
     Ion::Simulator::StoreScript::savePython();
   }
 
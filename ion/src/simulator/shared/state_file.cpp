@@ -1,5 +1,8 @@
 #include <ion.h>
 #include <ion/events.h>
+#include <ion/state.h>
+#include <ion/storage.h>
+#include <assert.h>
 #include <stdio.h>
 #include <string.h>
 #include "journal.h"
@@ -9,13 +12,128 @@ namespace Simulator {
 namespace StateFile {
 
 static constexpr const char * sHeader = "NWSF";
+static constexpr const char * sSnapshotHeader = "NWSS";
 static constexpr int sHeaderLength = 4;
 static constexpr int sVersionLength = 8;
 static constexpr const char * sWildcardVersion = "**.**.**";
+static constexpr uint8_t sSnapshotFormatVersion = 1;
+static constexpr int sMaxStateSize = 256;
 
-/* File format: * "NWSF" + "XXXXXXXX" (version) + EVENTS... */
+/* Journal format: "NWSF" + "XXXXXXXX" (version) + EVENTS...
+ * Snapshot format: "NWSS" + "XXXXXXXX" (version) + FORMAT VERSION (1 byte)
+ *   + NUMBER OF RECORDS (2 bytes)
+ *   + [NAME LENGTH (2 bytes) + NAME + VALUE SIZE (2 bytes) + VALUE]...
+ *   + STATE SIZE (2 bytes) + STATE + EVENTS...
+ * A journal is restored by replaying all its events. A snapshot restores the
+ * storage and the state serialized by the State::Delegate at once, and only
+ * replays its optional events tail. */
 
-static inline bool load(FILE * f) {
+static char sPendingState[sMaxStateSize];
+static int sPendingStateSize = -1;
+static State::Delegate * sDelegate = nullptr;
+static bool sRecordsJournal = false;
+
+static inline bool readShort(FILE * f, uint16_t * value) {
+  return fread(value, sizeof(uint16_t), 1, f) == 1;
+}
+
+static inline bool writeShort(FILE * f, uint16_t value) {
+  return fwrite(&value, sizeof(uint16_t), 1, f) == 1;
+}
+
+/* The records are staged in the layout of the storage buffer:
+ * [RECORD SIZE (2 bytes) + NAME + '\0' + VALUE]..., so that records fitting in
+ * sRecords also fit in an empty storage. */
+static char sRecords[Storage::k_storageSize];
+
+static inline bool stagedNameIsTaken(const char * recordsEnd, const char * name) {
+  const char * record = sRecords;
+  while (record < recordsEnd) {
+    uint16_t recordSize;
+    memcpy(&recordSize, record, sizeof(uint16_t));
+    if (strcmp(record + sizeof(uint16_t), name) == 0) {
+      return true;
+    }
+    record += recordSize;
+  }
+  return false;
+}
+
+static inline bool loadSnapshot(FILE * f) {
+  if (sDelegate != nullptr) {
+    /* The storage cannot be replaced under a running app, snapshots can only
+     * be restored at launch. */
+    return false;
+  }
+  uint8_t formatVersion = 0;
+  if (fread(&formatVersion, 1, 1, f) != 1 || formatVersion != sSnapshotFormatVersion) {
+    return false;
+  }
+
+  /* The whole snapshot is read and checked before the storage is replaced, so
+   * that an invalid snapshot leaves the storage untouched. */
+  uint16_t numberOfRecords = 0;
+  if (!readShort(f, &numberOfRecords)) {
+    return false;
+  }
+  // The storage keeps room for a null size after its last record
+  const char * recordsLimit = sRecords + Storage::k_storageSize - sizeof(uint16_t);
+  char * recordsEnd = sRecords;
+  for (int i = 0; i < numberOfRecords; i++) {
+    uint16_t nameLength = 0;
+    uint16_t valueSize = 0;
+    char * name = recordsEnd + sizeof(uint16_t);
+    if (!readShort(f, &nameLength)
+        || nameLength == 0
+        || name + nameLength + 1 > recordsLimit
+        || fread(name, 1, nameLength, f) != nameLength
+        || memchr(name, 0, nameLength) != nullptr)
+    {
+      return false;
+    }
+    name[nameLength] = 0;
+    char * value = name + nameLength + 1;
+    if (!readShort(f, &valueSize)
+        || value + valueSize > recordsLimit
+        || fread(value, 1, valueSize, f) != valueSize
+        || stagedNameIsTaken(recordsEnd, name))
+    {
+      return false;
+    }
+    uint16_t recordSize = value + valueSize - recordsEnd;
+    memcpy(recordsEnd, &recordSize, sizeof(uint16_t));
+    recordsEnd += recordSize;
+  }
+
+  // Delegate state
+  uint16_t stateSize = 0;
+  if (!readShort(f, &stateSize)
+      || stateSize > sMaxStateSize
+      || fread(sPendingState, 1, stateSize, f) != stateSize)
+  {
+    return false;
+  }
+
+  // Storage
+  Storage * storage = Storage::sharedStorage();
+  storage->destroyAllRecords();
+  const char * record = sRecords;
+  while (record < recordsEnd) {
+    uint16_t recordSize;
+    memcpy(&recordSize, record, sizeof(uint16_t));
+    const char * name = record + sizeof(uint16_t);
+    size_t nameSize = strlen(name) + 1;
+    Storage::Record::ErrorStatus error = storage->createRecordWithFullName(name, name + nameSize, recordSize - sizeof(uint16_t) - nameSize);
+    // The staged records were checked to fit in the storage with distinct names
+    assert(error == Storage::Record::ErrorStatus::None);
+    (void)error;
+    record += recordSize;
+  }
+  sPendingStateSize = stateSize;
+  return true;
+}
+
+static inline bool load(FILE * f, bool * restoredStorage) {
   char buffer[sVersionLength+1];
 
   // Header
@@ -23,7 +141,8 @@ static inline bool load(FILE * f) {
   if (fread(buffer, sHeaderLength, 1, f) != 1) {
     return false;
   }
-  if (strcmp(buffer, sHeader) != 0) {
+  bool isSnapshot = strcmp(buffer, sSnapshotHeader) == 0;
+  if (!isSnapshot && strcmp(buffer, sHeader) != 0) {
     return false;
   }
 
@@ -36,6 +155,14 @@ static inline bool load(FILE * f) {
     return false;
   }
 
+  // Snapshot
+  if (isSnapshot) {
+    if (!loadSnapshot(f)) {
+      return false;
+    }
+    *restoredStorage = true;
+  }
+
   // Events
   Ion::Events::Journal * journal = Journal::replayJournal();
   int c = 0;
@@ -51,7 +178,7 @@ static inline bool load(FILE * f) {
   return true;
 }
 
-void load(const char * filename) {
+bool load(const char * filename) {
   FILE * f = nullptr;
   if (strcmp(filename, "-") == 0) {
     f = stdin;
@@ -59,15 +186,62 @@ void load(const char * filename) {
     f = fopen(filename, "rb");
   }
   if (f == nullptr) {
-    return;
+    return false;
   }
-  load(f);
+  bool restoredStorage = false;
+  load(f, &restoredStorage);
   if (f != stdin) {
     fclose(f);
   }
+  return restoredStorage;
 }
 
-static inline bool save(FILE * f) {
+static inline bool saveSnapshot(FILE * f) {
+  if (fwrite(sSnapshotHeader, sHeaderLength, 1, f) != 1) {
+    return false;
+  }
+  if (fwrite(softwareVersion(), sVersionLength, 1, f) != 1) {
+    return false;
+  }
+  if (fwrite(&sSnapshotFormatVersion, 1, 1, f) != 1) {
+    return false;
+  }
+
+  // Storage
+  Storage * storage = Storage::sharedStorage();
+  int numberOfRecords = storage->numberOfRecords();
+  if (!writeShort(f, numberOfRecords)) {
+    return false;
+  }
+  for (int i = 0; i < numberOfRecords; i++) {
+    Storage::Record record = storage->recordAtIndex(i);
+    const char * name = record.fullName();
+    uint16_t nameLength = strlen(name);
+    Storage::Record::Data value = record.value();
+    if (!writeShort(f, nameLength)
+        || fwrite(name, 1, nameLength, f) != nameLength
+        || !writeShort(f, value.size)
+        || fwrite(value.buffer, 1, value.size, f) != value.size)
+    {
+      return false;
+    }
+  }
+
+  // Delegate state
+  char state[sMaxStateSize];
+  int stateSize = sDelegate != nullptr ? sDelegate->serializeState(state, sMaxStateSize) : 0;
+  if (stateSize < 0) {
+    stateSize = 0;
+  }
+  if (!writeShort(f, stateSize) || fwrite(state, 1, stateSize, f) != static_cast<size_t>(stateSize)) {
+    return false;
+  }
+
+  // The snapshot accounts for the whole session, no events tail is written
+  return true;
+}
+
+static inline bool saveJournal(FILE * f) {
   if (fwrite(sHeader, sHeaderLength, 1, f) != 1) {
     return false;
   }
@@ -75,7 +249,6 @@ static inline bool save(FILE * f) {
     return false;
   }
   Ion::Events::Journal * journal = Journal::logJournal();
-  Ion::Events::Event e;
   while (!journal->isEmpty()) {
     Ion::Events::Event e = journal->popEvent();
     uint8_t code = static_cast<uint8_t>(e);
@@ -87,14 +260,35 @@ static inline bool save(FILE * f) {
 }
 
 void save(const char * filename) {
-  FILE * f = fopen(filename, "w");
+  FILE * f = fopen(filename, "wb");
   if (f == nullptr) {
     return;
   }
-  save(f);
+  if (sRecordsJournal) {
+    saveJournal(f);
+  } else {
+    saveSnapshot(f);
+  }
   fclose(f);
 }
 
+void recordJournal() {
+  sRecordsJournal = true;
+  Journal::init();
 }
+
+}
+}
+
+namespace State {
+
+void setDelegate(Delegate * delegate) {
+  Simulator::StateFile::sDelegate = delegate;
+  if (delegate != nullptr && Simulator::StateFile::sPendingStateSize >= 0) {
+    delegate->restoreState(Simulator::StateFile::sPendingState, Simulator::StateFile::sPendingStateSize);
+    Simulator::StateFile::sPendingStateSize = -1;
+  }
+}
+
 }
 }
@@ -5,8 +5,12 @@ namespace Ion {
 namespace Simulator {
 namespace StateFile {
 
-void load(const char * filename);
+// Returns true if the storage was restored from a snapshot
+bool load(const char * filename);
 void save(const char * filename);
+/* Log the events so that states are saved as NWSF journals, which replay the
+ * session event by event, instead of snapshots. */
+void recordJournal();
 
 }
 }
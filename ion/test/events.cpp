@@ -1,6 +1,10 @@
 #include <quiz.h>
 #include <ion.h>
 #include <assert.h>
+#if !PLATFORM_DEVICE
+#include <ion/src/simulator/shared/journal.h>
+#include <ion/src/simulator/shared/keyboard.h>
+#endif
 
 using namespace Ion::Keyboard;
 using namespace Ion::Events;
@@ -24,3 +28,39 @@ QUIZ_CASE(ion_events_from_keyboard) {
   quiz_assert(Event(Key::EXE, false, true, true) == EXE);
   quiz_assert(Event(Key::EXE, true, true, true) == EXE);
 }
+
+#if !PLATFORM_DEVICE
+
+static Event get_event(int timeout, int * elapsed = nullptr) {
+  int remainingTime = timeout;
+  Event e = getEvent(&remainingTime);
+  if (elapsed != nullptr) {
+    *elapsed = timeout - remainingTime;
+  }
+  return e;
+}
+
+QUIZ_CASE(ion_events_from_keyboard_repetition) {
+  // A headless simulator terminates once it has no events left to replay
+  Ion::Simulator::Journal::replayJournal()->pushEvent(Home);
+
+  // Polls report key presses, but never repeat them
+  quiz_assert(get_event(0) == None);
+  Ion::Simulator::Keyboard::keyDown(Key::Left);
+  quiz_assert(get_event(0) == Left);
+  Ion::Timing::msleep(300);
+  quiz_assert(get_event(0) == None);
+
+  // A held key repeats after the full delay of a regular call
+  int elapsed = 0;
+  quiz_assert(get_event(300, &elapsed) == Left);
+  quiz_assert(elapsed >= 200);
+  quiz_assert(get_event(300, &elapsed) == Left);
+  quiz_assert(elapsed >= 50 && elapsed < 200);
+  Ion::Simulator::Keyboard::keyUp(Key::Left);
+  quiz_assert(get_event(0) == None);
+
+  Ion::Simulator::Journal::replayJournal()->popEvent();
+}
+
+#endif
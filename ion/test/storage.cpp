@@ -500,3 +500,31 @@ aaaaaa)";
   retrievedRecord3.destroy();
   retrievedRecord4.destroy();
 }
+
+QUIZ_CASE(ion_storage_checksum_invalidation) {
+  const char * baseNameRecord = "ionTestStorage";
+  const char * extensionRecord = "record1";
+  uint32_t emptyChecksum = Storage::sharedStorage()->checksum();
+
+  Storage::Record::ErrorStatus error = putRecordInSharedStorage(baseNameRecord, extensionRecord, "abc");
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  uint32_t checksum = Storage::sharedStorage()->checksum();
+  quiz_assert(checksum != emptyChecksum);
+
+  // Setting a value notifies the change
+  Storage::Record record = Storage::sharedStorage()->recordBaseNamedWithExtension(baseNameRecord, extensionRecord);
+  error = record.setValue({.buffer = "abd", .size = 3});
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksum() != checksum);
+  checksum = Storage::sharedStorage()->checksum();
+
+  // Edits made in place are only seen once the checksum is invalidated
+  char * value = const_cast<char *>(static_cast<const char *>(record.value().buffer));
+  value[2] = 'e';
+  quiz_assert(Storage::sharedStorage()->checksum() == checksum);
+  Storage::sharedStorage()->invalidateChecksum();
+  quiz_assert(Storage::sharedStorage()->checksum() != checksum);
+
+  record.destroy();
+  quiz_assert(Storage::sharedStorage()->checksum() == emptyChecksum);
+}
@@ -32,6 +32,10 @@ public:
   void fillRect(KDRect rect, KDColor color);
   void fillRectWithPixels(KDRect rect, const KDColor * pixels, KDColor * workingBuffer);
   void blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDColor * workingBuffer);
+  /* Same as blendRectWithMask, but only the span of each row (or column) where
+   * the mask is not transparent (0xFF) is pulled and pushed. The working
+   * buffer must hold a whole row (or column). */
+  void blendSpansWithMask(KDRect rect, KDColor color, const uint8_t * mask, bool columns, KDColor * workingBuffer);
   void strokeRect(KDRect rect, KDColor color);
   virtual void pushRect(KDRect, const KDColor * pixels) = 0;
   virtual void pushRectUniform(KDRect rect, KDColor color) = 0;
@@ -46,14 +46,25 @@ void KDContext::drawLine(KDPoint p1, KDPoint p2, KDColor c) {
     conditionalTranslate = KDPoint((bottom.x() >= top.x() ? 1 : -1), 0);
   }
 
+  /* Consecutive pixels along the scan direction form a run, which is pushed
+   * at once instead of pixel by pixel. */
+  KDPoint runStart = p;
+  KDCoordinate runLength = 0;
   KDCoordinate scanCounter = 0;
   while (scanCounter++ < scanLength) {
-    setPixel(p, c);
+    runLength++;
     p = p.translatedBy(alwaysTranslate);
     error = error - minusError;
+    bool endOfRun = scanCounter == scanLength;
     if (error <= 0) {
       p = p.translatedBy(conditionalTranslate);
       error = error + plusError;
+      endOfRun = true;
+    }
+    if (endOfRun) {
+      fillRect(KDRect(runStart, alwaysTranslate.x() == 0 ? 1 : runLength, alwaysTranslate.x() == 0 ? runLength : 1), c);
+      runStart = p;
+      runLength = 0;
     }
   }
 }
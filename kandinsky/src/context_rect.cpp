@@ -86,6 +86,43 @@ void KDContext::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * ma
   pushRect(absoluteRect, workingBuffer);
 }
 
+void KDContext::blendSpansWithMask(KDRect rect, KDColor color, const uint8_t * mask, bool columns, KDColor * workingBuffer) {
+  KDCoordinate numberOfLines = columns ? rect.width() : rect.height();
+  KDCoordinate lineLength = columns ? rect.height() : rect.width();
+  KDCoordinate lineStride = columns ? 1 : rect.width();
+  KDCoordinate pixelStride = columns ? rect.width() : 1;
+  for (KDCoordinate l = 0; l < numberOfLines; l++) {
+    const uint8_t * lineMask = mask + l * lineStride;
+    KDCoordinate first = 0;
+    while (first < lineLength && lineMask[first * pixelStride] == 0xFF) {
+      first++;
+    }
+    if (first == lineLength) {
+      continue;
+    }
+    KDCoordinate last = lineLength - 1;
+    while (lineMask[last * pixelStride] == 0xFF) {
+      last--;
+    }
+    KDRect span = columns ?
+      KDRect(rect.x() + l, rect.y() + first, 1, last - first + 1) :
+      KDRect(rect.x() + first, rect.y() + l, last - first + 1, 1);
+    KDRect absoluteSpan = absoluteFillRect(span);
+    if (absoluteSpan.isEmpty()) {
+      continue;
+    }
+    KDRect translatedSpan = span.translatedBy(m_origin);
+    // The span may have been clipped
+    KDCoordinate offset = first + (columns ? absoluteSpan.y() - translatedSpan.y() : absoluteSpan.x() - translatedSpan.x());
+    KDCoordinate length = columns ? absoluteSpan.height() : absoluteSpan.width();
+    pullRect(absoluteSpan, workingBuffer);
+    for (KDCoordinate i = 0; i < length; i++) {
+      workingBuffer[i] = KDColor::blend(workingBuffer[i], color, lineMask[(offset + i) * pixelStride]);
+    }
+    pushRect(absoluteSpan, workingBuffer);
+  }
+}
+
 void KDContext::strokeRect(KDRect rect, KDColor color) {
   fillRect(KDRect(rect.origin(), rect.width(), 1), color);
   fillRect(KDRect(KDPoint(rect.x(), rect.bottom()), rect.width(), 1), color);
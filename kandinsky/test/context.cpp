@@ -0,0 +1,94 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <kandinsky/framebuffer_context.h>
+#include <assert.h>
+
+constexpr KDCoordinate k_width = 16;
+constexpr KDCoordinate k_height = 16;
+
+class CountingContext : public KDFrameBufferContext {
+public:
+  CountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  int numberOfPushes() const { return m_numberOfPushes; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRectUniform(rect, color);
+  }
+private:
+  int m_numberOfPushes;
+};
+
+static void fill(KDColor * pixels, KDColor color) {
+  for (int i = 0; i < k_width*k_height; i++) {
+    pixels[i] = color;
+  }
+}
+
+QUIZ_CASE(kandinsky_context_draw_line) {
+  KDColor pixels[k_width*k_height];
+  fill(pixels, KDColorWhite);
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  CountingContext context(&frameBuffer);
+
+  // A horizontal line is a single run
+  context.drawLine(KDPoint(2, 3), KDPoint(12, 3), KDColorBlack);
+  quiz_assert(context.numberOfPushes() == 1);
+  for (int x = 0; x < k_width; x++) {
+    quiz_assert(pixels[3*k_width+x] == ((x >= 2 && x < 12) ? KDColorBlack : KDColorWhite));
+  }
+
+  // A line of slope 1/2 is made of runs of at most two pixels
+  fill(pixels, KDColorWhite);
+  context.drawLine(KDPoint(0, 0), KDPoint(8, 4), KDColorRed);
+  quiz_assert(context.numberOfPushes() == 1 + 5);
+  int numberOfColoredPixels = 0;
+  for (int i = 0; i < k_width*k_height; i++) {
+    numberOfColoredPixels += pixels[i] == KDColorRed;
+  }
+  quiz_assert(numberOfColoredPixels == 8);
+  for (int x = 0; x < 8; x++) {
+    quiz_assert(pixels[(x+1)/2*k_width+x] == KDColorRed);
+  }
+}
+
+QUIZ_CASE(kandinsky_context_blend_spans_with_mask) {
+  constexpr KDCoordinate maskWidth = 6;
+  constexpr KDCoordinate maskHeight = 5;
+  const uint8_t mask[maskWidth*maskHeight] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  };
+  KDColor workingBuffer[maskWidth*maskHeight];
+  KDColor expected[k_width*k_height];
+  KDColor pixels[k_width*k_height];
+  KDFrameBuffer expectedFrameBuffer(expected, KDSize(k_width, k_height));
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext expectedContext(&expectedFrameBuffer);
+  CountingContext context(&frameBuffer);
+  // The last rect is partially clipped
+  KDPoint origins[] = {KDPoint(3, 4), KDPoint(-2, 12)};
+  for (int c = 0; c < 2; c++) {
+    bool columns = c == 1;
+    for (KDPoint origin : origins) {
+      fill(expected, KDColorWhite);
+      fill(pixels, KDColorWhite);
+      KDRect rect(origin, maskWidth, maskHeight);
+      expectedContext.blendRectWithMask(rect, KDColorBlue, mask, workingBuffer);
+      context.blendSpansWithMask(rect, KDColorBlue, mask, columns, workingBuffer);
+      for (int i = 0; i < k_width*k_height; i++) {
+        quiz_assert(pixels[i] == expected[i]);
+      }
+    }
+  }
+  /* One push per visible span: the first column of the clipped rect is not
+   * visible. */
+  quiz_assert(context.numberOfPushes() == 3 + 3 + 4 + 3);
+}
@@ -1,9 +1,6 @@
 #include <strings.h>
+#include <string.h>
 
 void bzero(void * s, size_t n) {
-  char *t = s;
-  while (n != 0) {
-    *t++ = 0;
-    n--;
-  }
+  memset(s, 0, n);
 }
@@ -1,11 +1,49 @@
 #include <string.h>
+#include "word_access.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memcpy(void * dst, const void * src, size_t n) __attribute__((externally_visible));
 
+/* memcpy copies from front to back and always reads a word before writing
+ * the word that precedes it. memmove relies on this to handle overlapping
+ * buffers whose destination is before the source. */
+
 void * __attribute__((noinline)) memcpy(void * dst, const void * src, size_t n) {
-  char * destination = (char *)dst;
-  char * source = (char *)src;
+  unsigned char * destination = (unsigned char *)dst;
+  const unsigned char * source = (const unsigned char *)src;
+
+  if (n >= LIBA_WORD_COPY_THRESHOLD) {
+    while (!liba_is_word_aligned(destination)) {
+      *destination++ = *source++;
+      n--;
+    }
+    liba_word_t * destinationWord = (liba_word_t *)destination;
+    if (liba_is_word_aligned(source)) {
+      const liba_word_t * sourceWord = (const liba_word_t *)source;
+      size_t numberOfBlocks = n / LIBA_BLOCK_SIZE;
+      n %= LIBA_BLOCK_SIZE;
+      while (numberOfBlocks--) {
+        destinationWord[0] = sourceWord[0];
+        destinationWord[1] = sourceWord[1];
+        destinationWord[2] = sourceWord[2];
+        destinationWord[3] = sourceWord[3];
+        destinationWord += 4;
+        sourceWord += 4;
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        *destinationWord++ = *sourceWord++;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWord;
+    } else {
+      while (n >= LIBA_WORD_SIZE) {
+        *destinationWord++ = ((const liba_unaligned_word_t *)source)->value;
+        source += LIBA_WORD_SIZE;
+        n -= LIBA_WORD_SIZE;
+      }
+    }
+    destination = (unsigned char *)destinationWord;
+  }
 
   while (n--) {
     *destination++ = *source++;
@@ -1,20 +1,53 @@
 #include <string.h>
+#include "word_access.h"
 
 void * memmove(void * dst, const void * src, size_t n) {
-  char * destination = (char *)dst;
-  char * source = (char *)src;
+  unsigned char * destination = (unsigned char *)dst;
+  const unsigned char * source = (const unsigned char *)src;
 
-  if (source < destination && destination < source + n) {
-    /* Copy backwards to avoid overwrites */
-    source += n;
-    destination += n;
-    while (n--) {
+  if (destination <= source || destination >= source + n) {
+    /* memcpy copies forwards without overwriting bytes it has not read yet */
+    return memcpy(dst, src, n);
+  }
+
+  /* Copy backwards to avoid overwrites */
+  source += n;
+  destination += n;
+  if (n >= LIBA_WORD_COPY_THRESHOLD) {
+    while (!liba_is_word_aligned(destination)) {
       *--destination = *--source;
+      n--;
     }
-  } else {
-    while (n--) {
-      *destination++ = *source++;
+    liba_word_t * destinationWord = (liba_word_t *)destination;
+    if (liba_is_word_aligned(source)) {
+      const liba_word_t * sourceWord = (const liba_word_t *)source;
+      size_t numberOfBlocks = n / LIBA_BLOCK_SIZE;
+      n %= LIBA_BLOCK_SIZE;
+      while (numberOfBlocks--) {
+        destinationWord -= 4;
+        sourceWord -= 4;
+        destinationWord[3] = sourceWord[3];
+        destinationWord[2] = sourceWord[2];
+        destinationWord[1] = sourceWord[1];
+        destinationWord[0] = sourceWord[0];
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        *--destinationWord = *--sourceWord;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWord;
+    } else {
+      while (n >= LIBA_WORD_SIZE) {
+        source -= LIBA_WORD_SIZE;
+        *--destinationWord = ((const liba_unaligned_word_t *)source)->value;
+        n -= LIBA_WORD_SIZE;
+      }
     }
+    destination = (unsigned char *)destinationWord;
+  }
+
+  while (n--) {
+    *--destination = *--source;
   }
 
   return dst;
@@ -1,12 +1,38 @@
 #include <string.h>
+#include "word_access.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memset(void * b, int c, size_t len) __attribute__((externally_visible));
 
 void * __attribute__((noinline)) memset(void * b, int c, size_t len) {
-  char * destination = (char *)b;
+  unsigned char * destination = (unsigned char *)b;
+  unsigned char byte = (unsigned char)c;
+
+  if (len >= LIBA_WORD_COPY_THRESHOLD) {
+    while (!liba_is_word_aligned(destination)) {
+      *destination++ = byte;
+      len--;
+    }
+    liba_word_t * destinationWord = (liba_word_t *)destination;
+    liba_word_t word = byte * (liba_word_t)0x01010101;
+    size_t numberOfBlocks = len / LIBA_BLOCK_SIZE;
+    len %= LIBA_BLOCK_SIZE;
+    while (numberOfBlocks--) {
+      destinationWord[0] = word;
+      destinationWord[1] = word;
+      destinationWord[2] = word;
+      destinationWord[3] = word;
+      destinationWord += 4;
+    }
+    while (len >= LIBA_WORD_SIZE) {
+      *destinationWord++ = word;
+      len -= LIBA_WORD_SIZE;
+    }
+    destination = (unsigned char *)destinationWord;
+  }
+
   while (len--) {
-    *destination++ = (unsigned char)c;
+    *destination++ = byte;
   }
   return b;
 }
@@ -0,0 +1,27 @@
+#ifndef LIBA_WORD_ACCESS_H
+#define LIBA_WORD_ACCESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* memcpy, memmove and memset move memory one word at a time. Words are
+ * accessed through may_alias types because the buffers can hold objects of
+ * any type. The source of a copy is not always word-aligned relatively to
+ * its destination, so it can also be read through a packed type: Cortex-M4
+ * and M7 cores perform unaligned single-word loads in hardware, and the
+ * compiler splits the access on targets that cannot. */
+
+typedef uint32_t __attribute__((may_alias)) liba_word_t;
+typedef struct { liba_word_t value; } __attribute__((packed, may_alias)) liba_unaligned_word_t;
+
+#define LIBA_WORD_SIZE (sizeof(liba_word_t))
+/* Aligned copies are unrolled by blocks of four words */
+#define LIBA_BLOCK_SIZE (4 * LIBA_WORD_SIZE)
+/* Below this length, aligning the pointers costs more than it saves */
+#define LIBA_WORD_COPY_THRESHOLD (2 * LIBA_WORD_SIZE)
+
+static inline int liba_is_word_aligned(const void * p) {
+  return ((uintptr_t)p & (LIBA_WORD_SIZE - 1)) == 0;
+}
+
+#endif
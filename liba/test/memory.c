@@ -0,0 +1,169 @@
+#include <quiz.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* liba's implementations are compiled here under other names, so that they
+ * are also tested on the simulator, which uses the host's C library. */
+
+#define memcpy liba_memcpy
+#define memmove liba_memmove
+#define memset liba_memset
+#define bzero liba_bzero
+#include "../src/memcpy.c"
+#include "../src/memmove.c"
+#include "../src/memset.c"
+#include "../src/bzero.c"
+#undef memcpy
+#undef memmove
+#undef memset
+#undef bzero
+
+#define k_maxOffset 8
+#define k_maxLength 80
+#define k_bufferSize (2 * k_maxOffset + k_maxLength + 8)
+
+static unsigned char pattern_byte(size_t i) {
+  return (unsigned char)(i * 7 + 13);
+}
+
+static void fill_with_pattern(unsigned char * buffer, size_t size, size_t seed) {
+  for (size_t i = 0; i < size; i++) {
+    buffer[i] = pattern_byte(i + seed);
+  }
+}
+
+static size_t tested_length(int i) {
+  /* All the short lengths, which hit every combination of head and tail, and
+   * a few lengths spanning several blocks */
+  static const size_t longLengths[] = {k_maxLength - 1, k_maxLength};
+  return i < 64 ? i : longLengths[i - 64];
+}
+#define k_numberOfTestedLengths 66
+
+QUIZ_CASE(liba_memcpy) {
+  unsigned char source[k_bufferSize];
+  unsigned char destination[k_bufferSize];
+  for (int sourceOffset = 0; sourceOffset < k_maxOffset; sourceOffset++) {
+    for (int destinationOffset = 0; destinationOffset < k_maxOffset; destinationOffset++) {
+      for (int l = 0; l < k_numberOfTestedLengths; l++) {
+        size_t length = tested_length(l);
+        fill_with_pattern(source, k_bufferSize, 0);
+        fill_with_pattern(destination, k_bufferSize, 100);
+        quiz_assert(liba_memcpy(destination + destinationOffset, source + sourceOffset, length) == destination + destinationOffset);
+        for (size_t i = 0; i < k_bufferSize; i++) {
+          bool copied = i >= (size_t)destinationOffset && i < destinationOffset + length;
+          quiz_assert(destination[i] == (copied ? pattern_byte(i - destinationOffset + sourceOffset) : pattern_byte(i + 100)));
+        }
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_memmove) {
+  /* Source and destination overlap in both directions */
+  unsigned char buffer[k_bufferSize];
+  for (int sourceOffset = 0; sourceOffset < 2 * k_maxOffset; sourceOffset++) {
+    for (int destinationOffset = 0; destinationOffset < 2 * k_maxOffset; destinationOffset++) {
+      for (int l = 0; l < k_numberOfTestedLengths; l++) {
+        size_t length = tested_length(l);
+        fill_with_pattern(buffer, k_bufferSize, 0);
+        quiz_assert(liba_memmove(buffer + destinationOffset, buffer + sourceOffset, length) == buffer + destinationOffset);
+        for (size_t i = 0; i < k_bufferSize; i++) {
+          bool copied = i >= (size_t)destinationOffset && i < destinationOffset + length;
+          quiz_assert(buffer[i] == pattern_byte(copied ? i - destinationOffset + sourceOffset : i));
+        }
+      }
+    }
+  }
+}
+
+static void assert_filled(const unsigned char * buffer, int offset, size_t length, unsigned char value) {
+  for (size_t i = 0; i < k_bufferSize; i++) {
+    bool filled = i >= (size_t)offset && i < offset + length;
+    quiz_assert(buffer[i] == (filled ? value : pattern_byte(i)));
+  }
+}
+
+QUIZ_CASE(liba_memset) {
+  unsigned char buffer[k_bufferSize];
+  const int values[] = {0, 0xA5, -1, 0x1FF};
+  for (size_t v = 0; v < sizeof(values)/sizeof(values[0]); v++) {
+    for (int offset = 0; offset < k_maxOffset; offset++) {
+      for (int l = 0; l < k_numberOfTestedLengths; l++) {
+        size_t length = tested_length(l);
+        fill_with_pattern(buffer, k_bufferSize, 0);
+        quiz_assert(liba_memset(buffer + offset, values[v], length) == buffer + offset);
+        assert_filled(buffer, offset, length, (unsigned char)values[v]);
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_bzero) {
+  unsigned char buffer[k_bufferSize];
+  for (int offset = 0; offset < k_maxOffset; offset++) {
+    for (int l = 0; l < k_numberOfTestedLengths; l++) {
+      size_t length = tested_length(l);
+      fill_with_pattern(buffer, k_bufferSize, 0);
+      liba_bzero(buffer + offset, length);
+      assert_filled(buffer, offset, length, 0);
+    }
+  }
+}
+
+/* Run with --benchmark to compare the durations of moving a frame buffer's
+ * worth of bytes with each implementation, the byte-wise loop that liba used
+ * before being the reference. */
+
+#define k_benchmarkBufferSize 4096
+#define k_benchmarkNumberOfRuns 2000
+
+static unsigned char s_benchmarkSource[k_benchmarkBufferSize + k_maxOffset];
+static unsigned char s_benchmarkDestination[k_benchmarkBufferSize + k_maxOffset];
+
+static void __attribute__((noinline)) byte_copy(unsigned char * destination, const unsigned char * source, size_t n) {
+  while (n--) {
+    *destination++ = *source++;
+    // Keep the compiler from turning the reference loop into a memcpy call
+    __asm__ volatile ("" ::: "memory");
+  }
+}
+
+static void benchmark_copy(void * (*copy)(void *, const void *, size_t), int sourceOffset) {
+  fill_with_pattern(s_benchmarkSource, sizeof(s_benchmarkSource), 0);
+  for (int i = 0; i < k_benchmarkNumberOfRuns; i++) {
+    copy(s_benchmarkDestination, s_benchmarkSource + sourceOffset, k_benchmarkBufferSize);
+  }
+  quiz_assert(s_benchmarkDestination[k_benchmarkBufferSize - 1] == s_benchmarkSource[sourceOffset + k_benchmarkBufferSize - 1]);
+}
+
+QUIZ_CASE(liba_memory_benchmark_byte_copy) {
+  fill_with_pattern(s_benchmarkSource, sizeof(s_benchmarkSource), 0);
+  for (int i = 0; i < k_benchmarkNumberOfRuns; i++) {
+    byte_copy(s_benchmarkDestination, s_benchmarkSource, k_benchmarkBufferSize);
+  }
+  quiz_assert(s_benchmarkDestination[k_benchmarkBufferSize - 1] == s_benchmarkSource[k_benchmarkBufferSize - 1]);
+}
+
+QUIZ_CASE(liba_memory_benchmark_memcpy_aligned) {
+  benchmark_copy(liba_memcpy, 0);
+}
+
+QUIZ_CASE(liba_memory_benchmark_memcpy_misaligned) {
+  benchmark_copy(liba_memcpy, 1);
+}
+
+QUIZ_CASE(liba_memory_benchmark_memmove_overlapping) {
+  fill_with_pattern(s_benchmarkDestination, sizeof(s_benchmarkDestination), 0);
+  for (int i = 0; i < k_benchmarkNumberOfRuns; i++) {
+    liba_memmove(s_benchmarkDestination + 4, s_benchmarkDestination, k_benchmarkBufferSize);
+  }
+  quiz_assert(s_benchmarkDestination[4] == s_benchmarkDestination[0]);
+}
+
+QUIZ_CASE(liba_memory_benchmark_memset) {
+  for (int i = 0; i < k_benchmarkNumberOfRuns; i++) {
+    liba_memset(s_benchmarkDestination, i, k_benchmarkBufferSize);
+  }
+  quiz_assert(s_benchmarkDestination[k_benchmarkBufferSize - 1] == (unsigned char)(k_benchmarkNumberOfRuns - 1));
+}
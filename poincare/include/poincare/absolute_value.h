@@ -34,6 +34,7 @@ public:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::AbsoluteValue(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit)); }
 
   // Layout
   Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const override;
@@ -70,6 +70,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::MapReduce<double>(this, approximationContext, compute<double>, computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>, computeOnMatrices<double>);
    }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override;
 };
 
 class Addition final : public NAryExpression {
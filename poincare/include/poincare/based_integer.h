@@ -36,6 +36,7 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Value(templatedApproximate<double>()); }
   template<typename T> T templatedApproximate() const;
 
 private:
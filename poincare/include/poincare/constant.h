@@ -36,6 +36,7 @@ public:
   /* Approximation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(); }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return isPi() ? Interval::Value(M_PI) : isExponential() ? Interval::Value(M_E) : Interval::Unbounded(); }
 
   /* Symbol properties */
   bool isPi() const { return isConstantCodePoint(UCodePointGreekSmallLetterPi); }
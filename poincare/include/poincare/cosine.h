@@ -44,6 +44,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Cosine(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit), angleUnit); }
 };
 
 class Cosine final : public Expression {
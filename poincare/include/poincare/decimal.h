@@ -52,6 +52,7 @@ public:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return Complex<double>::Builder(templatedApproximate<double>());
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Value(templatedApproximate<double>()); }
 
   // Comparison
   /* Warning: Decimal(mantissa: 1000, exponent: 3) and Decimal(mantissa: 1, exponent: 3)
@@ -45,6 +45,7 @@ public:
         computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>,
         computeOnMatrices<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Multiply(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit), Interval::Inverse(childAtIndex(1)->approximateOnInterval(symbol, x, angleUnit))); }
 
   // Layout
   bool childNeedsSystemParenthesesAtSerialization(const TreeNode * child) const override;
@@ -47,7 +47,7 @@ public:
 private:
   void rollback();
 
-  static ExceptionCheckpoint * s_topmostExceptionCheckpoint;
+  static ION_THREAD_LOCAL ExceptionCheckpoint * s_topmostExceptionCheckpoint;
 
   jmp_buf m_jumpBuffer;
   TreeNode * m_endOfPoolBeforeCheckpoint;
@@ -265,6 +265,7 @@ public:
   template<typename U> U approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool withinReduce = false) const;
   template<typename U> static U ApproximateToScalar(const char * text, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, Preferences::UnitFormat unitFormat, ExpressionNode::SymbolicComputation symbolicComputation = ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition);
   template<typename U> U approximateWithValueForSymbol(const char * symbol, U x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
+  Interval approximateOnIntervalForSymbol(const char * symbol, float xMin, float xMax, Preferences::AngleUnit angleUnit) const { return node()->approximateOnInterval(symbol, Interval(xMin, xMax), angleUnit); }
   /* Expression roots/extrema solver */
   Coordinate2D<double> nextMinimum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
   Coordinate2D<double> nextMaximum(const char * symbol, double start, double step, double max, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) const;
@@ -280,7 +281,7 @@ public:
       m_name(name),
       m_numberOfChildren(numberOfChildren),
       m_untypedBuilder(builder) {}
-    const char * name() const { return m_name; }
+    constexpr const char * name() const { return m_name; }
     int numberOfChildren() const { return m_numberOfChildren; }
     Expression build(Expression children) const { return (*m_untypedBuilder)(children); }
   private:
@@ -405,7 +406,7 @@ protected:
 
 private:
   static constexpr int k_maxSymbolReplacementsCount = 10;
-  static bool sSymbolReplacementsCountLock;
+  static ION_THREAD_LOCAL bool sSymbolReplacementsCountLock;
 
   /* Add missing parenthesis will add parentheses that easen the reading of the
    * expression or that are required by math rules. For example:
@@ -3,6 +3,7 @@
 
 #include <poincare/tree_node.h>
 #include <poincare/evaluation.h>
+#include <poincare/interval.h>
 #include <poincare/layout.h>
 #include <poincare/context.h>
 #include <stdint.h>
@@ -282,6 +283,9 @@ public:
   constexpr static int k_maxNumberOfSteps = 10000;
   virtual Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const = 0;
   virtual Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const = 0;
+  /* Bound the real values of the expression when symbol spans x. Nodes that
+   * do not implement it give no bounds. */
+  virtual Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const { return Interval::Unbounded(); }
 
   /* Simplification */
   /*!*/ virtual void deepReduceChildren(ReductionContext reductionContext);
@@ -49,6 +49,7 @@ public:
   /* Evaluation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Value(m_value); }
 private:
   // Simplification
   LayoutShape leftLayoutShape() const override { return LayoutShape::Decimal; }
@@ -57,6 +57,7 @@ protected:
   KDSize computeSize() override;
   KDCoordinate computeBaseline() override;
   KDPoint positionOfChild(LayoutNode * l) override;
+  KDPoint positionOfChildAfter(LayoutNode * l, LayoutNode * previousChild, KDPoint previousChildPosition) override;
   KDRect relativeSelectionRect(const Layout * selectionStart, const Layout * selectionEnd) const;
 
 private:
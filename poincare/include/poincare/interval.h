@@ -0,0 +1,64 @@
+#ifndef POINCARE_INTERVAL_H
+#define POINCARE_INTERVAL_H
+
+#include <poincare/preferences.h>
+#include <float.h>
+#include <math.h>
+
+namespace Poincare {
+
+/* An Interval bounds the real values taken by an expression when one of its
+ * symbols spans an interval. The bounds are rounded outward, so that they
+ * hold despite float approximations. An Interval also tells whether the
+ * expression is defined and continuous on the whole input interval.
+ * Undefined and non-real values are not bounded : an empty Interval means
+ * that the expression has no real value on the input interval. */
+
+class Interval final {
+public:
+  static Interval Unbounded() { return Interval(-INFINITY, INFINITY, false); }
+  static Interval Empty() { return Interval(NAN, NAN, false); }
+  static Interval Value(double value);
+
+  Interval(float lowerBound, float upperBound, bool isContinuous = true) :
+    m_lowerBound(lowerBound),
+    m_upperBound(upperBound),
+    m_isContinuous(isContinuous)
+  {}
+  float lowerBound() const { return m_lowerBound; }
+  float upperBound() const { return m_upperBound; }
+  bool isEmpty() const { return !(m_lowerBound <= m_upperBound); }
+  bool isContinuous() const { return m_isContinuous && !isEmpty(); }
+  bool isPoint() const { return m_lowerBound == m_upperBound; }
+
+  static Interval Opposite(Interval a);
+  static Interval Add(Interval a, Interval b);
+  static Interval Multiply(Interval a, Interval b);
+  static Interval Inverse(Interval a);
+  static Interval Power(Interval base, Interval exponent);
+  static Interval SquareRoot(Interval a);
+  static Interval NaperianLogarithm(Interval a);
+  static Interval AbsoluteValue(Interval a);
+  static Interval Sine(Interval a, Preferences::AngleUnit angleUnit);
+  static Interval Cosine(Interval a, Preferences::AngleUnit angleUnit);
+
+private:
+  /* Basic operations are correctly rounded, one epsilon covers them. Standard
+   * library transcendental functions are only required to be faithful. */
+  static constexpr float k_arithmeticRelativeError = FLT_EPSILON;
+  static constexpr float k_transcendentalRelativeError = 4.0f * FLT_EPSILON;
+  /* Beyond this magnitude, reducing a float argument modulo 2π is too
+   * imprecise to locate the extrema of sine and cosine. */
+  static constexpr float k_maxTrigonometricArgument = 1e5f;
+
+  static Interval Rounded(float lowerBound, float upperBound, bool isContinuous, float relativeError);
+  static Interval IntegerPower(Interval a, int n);
+  static Interval SineInRadian(Interval a);
+  float m_lowerBound;
+  float m_upperBound;
+  bool m_isContinuous;
+};
+
+}
+
+#endif
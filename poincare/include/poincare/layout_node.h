@@ -155,6 +155,10 @@ protected:
   virtual KDSize computeSize() = 0;
   virtual KDCoordinate computeBaseline() = 0;
   virtual KDPoint positionOfChild(LayoutNode * child) = 0;
+  /* Drawing positions the children in order. Layouts whose positionOfChild
+   * walks the previous siblings override this to use the previous child's
+   * position instead. */
+  virtual KDPoint positionOfChildAfter(LayoutNode * child, LayoutNode * previousChild, KDPoint previousChildPosition) { return positionOfChild(child); }
 
   /* m_baseline is the signed vertical distance from the top of the layout to
    * the fraction bar of an hypothetical fraction sibling layout. If the top of
@@ -174,6 +178,11 @@ private:
     void * resultPosition,
     int * resultScore,
     bool forSelection);
+  /* Draws the layout and its descendants that intersect clippingRect, p being
+   * the position of the root layout. The absolute origin of the layout must
+   * be up to date, those of the descendants are set on the way. */
+  void drawSubtree(KDContext * ctx, KDPoint p, KDRect clippingRect, KDColor expressionColor, KDColor backgroundColor, bool backgroundIsFilled, Layout * selectionStart, Layout * selectionEnd, KDColor selectionColor);
+  bool isSelected(Layout * selectionStart, Layout * selectionEnd) const;
   virtual void render(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor, Layout * selectionStart = nullptr, Layout * selectionEnd = nullptr, KDColor selectionColor = KDColorRed) = 0;
   void changeGraySquaresOfAllMatrixRelatives(bool add, bool ancestors, bool * changedSquares);
 };
@@ -44,6 +44,10 @@ public:
   }
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override {
+    Interval base = numberOfChildren() == 2 ? childAtIndex(1)->approximateOnInterval(symbol, x, angleUnit) : Interval::Value(10.0);
+    return Interval::Multiply(Interval::NaperianLogarithm(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit)), Interval::Inverse(Interval::NaperianLogarithm(base)));
+  }
   template<typename U> Evaluation<U> templatedApproximate(ApproximationContext approximationContext) const;
 };
 
@@ -41,6 +41,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::NaperianLogarithm(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit)); }
 };
 
 class NaperianLogarithm final : public Expression {
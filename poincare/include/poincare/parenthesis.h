@@ -35,6 +35,7 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit); }
 private:
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
 };
@@ -70,6 +70,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Power(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit), childAtIndex(1)->approximateOnInterval(symbol, x, angleUnit)); }
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
 };
 
@@ -45,6 +45,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::Sine(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit), angleUnit); }
 };
 
 class Sine final : public Expression {
@@ -22,6 +22,11 @@ public:
   // Cumulative distributive inverse for function defined on N (positive integers)
   template<typename T> static T CumulativeDistributiveInverseForNDefinedFunction(T * probability, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
 
+  /* Cumulative distributive inverse for function defined on N (positive
+   * integers) whose cumulative distributive function can be evaluated directly:
+   * the abscissa is found by bisection instead of summing the terms one by one. */
+  template<typename T> static T CumulativeDistributiveInverseForNDefinedCumulativeFunction(T * probability, ValueAtAbscissa cumulativeEvaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
+
   // Cumulative distributive function for function defined on N (positive integers)
   template<typename T> static T CumulativeDistributiveFunctionForNDefinedFunction(T x, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
 
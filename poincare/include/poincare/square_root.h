@@ -38,6 +38,7 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  Interval approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const override { return Interval::SquareRoot(childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit)); }
 };
 
 class SquareRoot final : public Expression {
@@ -3,6 +3,7 @@
 
 #include "tree_node.h"
 #include <poincare/ghost_node.h>
+#include <ion/thread_local.h>
 #include <stddef.h>
 #include <string.h>
 #include <new>
@@ -22,7 +23,12 @@ public:
   static TreePool * sharedPool() { assert(SharedStaticPool != nullptr); return SharedStaticPool; }
   static void RegisterPool(TreePool * pool) {  assert(SharedStaticPool == nullptr); SharedStaticPool = pool; }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() :
+    m_cursor(buffer())
+#if POINCARE_TREE_POOL_STATISTICS
+    , m_highWaterMark(0)
+#endif
+  {}
 
   // Node
   TreeNode * node(uint16_t identifier) const {
@@ -49,13 +55,18 @@ public:
   __attribute__((__used__)) void log() { treeLog(std::cout); }
 #endif
   int numberOfNodes() const;
+#if POINCARE_TREE_POOL_STATISTICS
+  // Largest number of bytes used since the last reset
+  size_t highWaterMark() const { return m_highWaterMark; }
+  void resetHighWaterMark() { m_highWaterMark = m_cursor - buffer(); }
+#endif
 
 private:
   constexpr static int BufferSize = 16384;
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
 
-  static TreePool * SharedStaticPool;
+  static ION_THREAD_LOCAL TreePool * SharedStaticPool;
 
   // TreeNode
   void discardTreeNode(TreeNode * node);
@@ -147,6 +158,9 @@ private:
   const char * constBuffer() const { return reinterpret_cast<const char *>(m_alignedBuffer); }
   AlignedNodeBuffer m_alignedBuffer[BufferSize/ByteAlignment];
   char * m_cursor;
+#if POINCARE_TREE_POOL_STATISTICS
+  size_t m_highWaterMark;
+#endif
   IdentifierStack m_identifiers;
   uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
   static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
@@ -40,7 +40,7 @@ public:
     static constexpr int k_numberOfPrefixes = 13;
     static const Prefix * Prefixes();
     static const Prefix * EmptyPrefix();
-    const char * symbol() const { return m_symbol; }
+    constexpr const char * symbol() const { return m_symbol; }
     int8_t exponent() const { return m_exponent; }
     int serialize(char * buffer, int bufferSize) const;
   private:
@@ -118,12 +118,11 @@ public:
     virtual bool hasSpecialAdditionalExpressions(double value, Preferences::UnitFormat unitFormat) const { return false; }
     virtual int setAdditionalExpressions(double value, Expression * dest, int availableLength, ExpressionNode::ReductionContext reductionContext) const { return 0; }
 
-    const char * rootSymbol() const { return m_rootSymbol; }
+    constexpr const char * rootSymbol() const { return m_rootSymbol; }
     double ratio() const { return m_ratio; }
     bool isInputPrefixable() const { return m_inputPrefixable != Prefixable::None; }
     bool isOutputPrefixable() const { return m_outputPrefixable != Prefixable::None; }
     int serialize(char * buffer, int bufferSize, const Prefix * prefix) const;
-    bool canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const;
     bool canParse(const char * symbol, size_t length, const Prefix * * prefix) const;
     Expression toBaseUnits() const;
     bool canPrefix(const Prefix * prefix, bool input) const;
@@ -675,6 +674,69 @@ public:
   static constexpr int k_gallonRepresentativeIndex = 7;
   static_assert(strings_equal(k_volumeRepresentatives[k_gallonRepresentativeIndex].m_rootSymbol, "gal"), "Index for the Gallon Representative is incorrect.");
 
+  /* All representatives, ordered according to their root symbol so that
+   * CanParse can look a root symbol up by binary search. Its order and its
+   * completeness are checked at compile time in unit.cpp. */
+  static constexpr const Representative * k_representativesByRootSymbol[] = {
+    &k_currentRepresentatives[0],
+    &k_electricChargeRepresentatives[0],
+    &k_massRepresentatives[2],
+    &k_electricCapacitanceRepresentatives[0],
+    &k_inductanceRepresentatives[0],
+    &k_frequencyRepresentatives[0],
+    &k_energyRepresentatives[0],
+    &k_temperatureRepresentatives[0],
+    &k_volumeRepresentatives[0],
+    &k_forceRepresentatives[0],
+    &k_pressureRepresentatives[0],
+    &k_electricConductanceRepresentatives[0],
+    &k_magneticFieldRepresentatives[0],
+    &k_electricPotentialRepresentatives[0],
+    &k_powerRepresentatives[0],
+    &k_magneticFluxRepresentatives[0],
+    &k_surfaceRepresentatives[1],
+    &k_pressureRepresentatives[2],
+    &k_distanceRepresentatives[1],
+    &k_pressureRepresentatives[1],
+    &k_luminousIntensityRepresentatives[0],
+    &k_volumeRepresentatives[4],
+    &k_timeRepresentatives[3],
+    &k_energyRepresentatives[1],
+    &k_volumeRepresentatives[3],
+    &k_distanceRepresentatives[5],
+    &k_massRepresentatives[0],
+    &k_volumeRepresentatives[7],
+    &k_timeRepresentatives[2],
+    &k_surfaceRepresentatives[0],
+    &k_distanceRepresentatives[4],
+    &k_catalyticActivityRepresentatives[0],
+    &k_massRepresentatives[4],
+    &k_massRepresentatives[6],
+    &k_distanceRepresentatives[2],
+    &k_distanceRepresentatives[0],
+    &k_distanceRepresentatives[7],
+    &k_timeRepresentatives[1],
+    &k_amountOfSubstanceRepresentatives[0],
+    &k_timeRepresentatives[5],
+    &k_massRepresentatives[3],
+    &k_distanceRepresentatives[3],
+    &k_volumeRepresentatives[5],
+    &k_volumeRepresentatives[6],
+    &k_timeRepresentatives[0],
+    &k_massRepresentatives[5],
+    &k_massRepresentatives[1],
+    &k_volumeRepresentatives[2],
+    &k_volumeRepresentatives[1],
+    &k_timeRepresentatives[4],
+    &k_distanceRepresentatives[6],
+    &k_timeRepresentatives[6],
+    &k_temperatureRepresentatives[1],
+    &k_temperatureRepresentatives[2],
+    &k_electricResistanceRepresentatives[0]
+  };
+  // Length in bytes of the longest prefix symbol
+  static constexpr size_t k_maxPrefixSymbolLength = 2;
+
   Unit(const UnitNode * node) : Expression(node) {}
   static Unit Builder(const Representative * representative, const Prefix * prefix);
   static bool CanParse(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix);
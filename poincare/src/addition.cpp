@@ -55,6 +55,15 @@ bool AdditionNode::derivate(ReductionContext reductionContext, Expression symbol
   return Addition(this).derivate(reductionContext, symbol, symbolValue);
 }
 
+// Evaluation
+Interval AdditionNode::approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const {
+  Interval result = childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit);
+  for (int i = 1; i < numberOfChildren(); i++) {
+    result = Interval::Add(result, childAtIndex(i)->approximateOnInterval(symbol, x, angleUnit));
+  }
+  return result;
+}
+
 // Addition
 
 const Number Addition::NumeralFactor(const Expression & e) {
@@ -80,13 +80,13 @@ T BinomialDistribution::CumulativeDistributiveInverseForProbability(T probabilit
     return n;
   }
   T proba = probability;
-  return Solver::CumulativeDistributiveInverseForNDefinedFunction<T>(
+  return Solver::CumulativeDistributiveInverseForNDefinedCumulativeFunction<T>(
       &proba,
       [](double x, Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * n, const void * p, const void * isDouble) {
         if (*(bool *)isDouble) {
-          return (double)BinomialDistribution::EvaluateAtAbscissa<T>(x, *(reinterpret_cast<const double *>(n)), *(reinterpret_cast<const double *>(p)));
+          return (double)BinomialDistribution::CumulativeDistributiveFunctionAtAbscissa<T>(x, *(reinterpret_cast<const double *>(n)), *(reinterpret_cast<const double *>(p)));
         }
-        return (double)BinomialDistribution::EvaluateAtAbscissa<T>(x, *(reinterpret_cast<const float *>(n)), *(reinterpret_cast<const float *>(p)));
+        return (double)BinomialDistribution::CumulativeDistributiveFunctionAtAbscissa<T>(x, *(reinterpret_cast<const float *>(n)), *(reinterpret_cast<const float *>(p)));
       }, (Context *)nullptr, Preferences::ComplexFormat::Real, Preferences::AngleUnit::Degree, &n, &p, &isDouble);
     // Context, complex format and angle unit are dummy values
 }
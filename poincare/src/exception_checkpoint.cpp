@@ -2,7 +2,7 @@
 
 namespace Poincare {
 
-ExceptionCheckpoint * ExceptionCheckpoint::s_topmostExceptionCheckpoint;
+ION_THREAD_LOCAL ExceptionCheckpoint * ExceptionCheckpoint::s_topmostExceptionCheckpoint;
 
 ExceptionCheckpoint::ExceptionCheckpoint() :
   m_endOfPoolBeforeCheckpoint(TreePool::sharedPool()->last()),
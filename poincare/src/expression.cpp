@@ -16,8 +16,8 @@
 
 namespace Poincare {
 
-bool Expression::sSymbolReplacementsCountLock = false;
-static bool sApproximationEncounteredComplex = false;
+ION_THREAD_LOCAL bool Expression::sSymbolReplacementsCountLock = false;
+static ION_THREAD_LOCAL bool sApproximationEncounteredComplex = false;
 
 /* Constructor & Destructor */
 
@@ -48,8 +48,8 @@ Expression Expression::ExpressionFromAddress(const void * address, size_t size)
 
 /* Circuit breaker */
 
-static Expression::CircuitBreaker sCircuitBreaker = nullptr;
-static bool sSimplificationHasBeenInterrupted = false;
+static ION_THREAD_LOCAL Expression::CircuitBreaker sCircuitBreaker = nullptr;
+static ION_THREAD_LOCAL bool sSimplificationHasBeenInterrupted = false;
 
 void Expression::SetCircuitBreaker(CircuitBreaker cb) {
   sCircuitBreaker = cb;
@@ -757,7 +757,7 @@ Expression Expression::ExpressionWithoutSymbols(Expression e, Context * context,
    * We need a static "replacement count" to aggregate all calls to
    * ExpressionWithoutSymbols, as this method might be called from
    * hasReplaceableSymbols. */
-  static int replacementCount = 0;
+  static ION_THREAD_LOCAL int replacementCount = 0;
   bool unlock = false;
   if (!sSymbolReplacementsCountLock) {
     replacementCount = 0;
@@ -287,6 +287,12 @@ KDPoint HorizontalLayoutNode::positionOfChild(LayoutNode * l) {
   return KDPoint(x, y);
 }
 
+KDPoint HorizontalLayoutNode::positionOfChildAfter(LayoutNode * l, LayoutNode * previousChild, KDPoint previousChildPosition) {
+  assert(hasChild(l));
+  KDCoordinate x = previousChild == nullptr ? 0 : previousChildPosition.x() + previousChild->layoutSize().width();
+  return KDPoint(x, baseline() - l->baseline());
+}
+
 KDRect HorizontalLayoutNode::relativeSelectionRect(const Layout * selectionStart, const Layout * selectionEnd) const {
   assert(selectionStart != nullptr && !selectionStart->isUninitialized());
   assert(selectionEnd != nullptr && !selectionEnd->isUninitialized());
@@ -448,9 +454,6 @@ bool HorizontalLayoutNode::willReplaceChild(LayoutNode * oldChild, LayoutNode *
 }
 
 void HorizontalLayoutNode::render(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor, Layout * selectionStart, Layout * selectionEnd, KDColor selectionColor) {
-  // Fill the background
-  KDSize s = layoutSize();
-  ctx->fillRect(KDRect(p, s), backgroundColor);
   // Fill the selection background
   HorizontalLayout thisLayout = HorizontalLayout(this);
   bool childrenAreSelected = selectionStart != nullptr && selectionEnd != nullptr
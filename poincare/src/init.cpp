@@ -7,7 +7,7 @@ namespace Poincare {
 
 void Init() {
   // Create and register the shared static pool
-  static TreePool pool;
+  static ION_THREAD_LOCAL TreePool pool;
   TreePool::RegisterPool(&pool);
 }
 
@@ -32,8 +32,8 @@ namespace Poincare {
  * buffer). */
 // TODO: we might want to go back to allocating the native_uint_t arrays on the stack once we increase the stack size from 32k to?
 
-static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
-static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
+static ION_THREAD_LOCAL native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
+static ION_THREAD_LOCAL native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
 uint8_t log2(native_uint_t v) {
   constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(native_uint_t);
@@ -0,0 +1,206 @@
+#include <poincare/interval.h>
+#include <poincare/trigonometry.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Poincare {
+
+constexpr float
+  Interval::k_arithmeticRelativeError,
+  Interval::k_transcendentalRelativeError,
+  Interval::k_maxTrigonometricArgument;
+
+Interval Interval::Value(double value) {
+  if (std::isnan(value)) {
+    return Empty();
+  }
+  if (std::isinf(value)) {
+    return Unbounded();
+  }
+  float f = static_cast<float>(value);
+  if (static_cast<double>(f) == value) {
+    return Interval(f, f);
+  }
+  return Rounded(f, f, true, k_arithmeticRelativeError);
+}
+
+Interval Interval::Opposite(Interval a) {
+  if (a.isEmpty()) {
+    return Empty();
+  }
+  return Interval(-a.m_upperBound, -a.m_lowerBound, a.m_isContinuous);
+}
+
+Interval Interval::Add(Interval a, Interval b) {
+  if (a.isEmpty() || b.isEmpty()) {
+    return Empty();
+  }
+  return Rounded(a.m_lowerBound + b.m_lowerBound, a.m_upperBound + b.m_upperBound, a.m_isContinuous && b.m_isContinuous, k_arithmeticRelativeError);
+}
+
+Interval Interval::Multiply(Interval a, Interval b) {
+  if (a.isEmpty() || b.isEmpty()) {
+    return Empty();
+  }
+  const bool isContinuous = a.m_isContinuous && b.m_isContinuous;
+  const float products[] = {
+    a.m_lowerBound * b.m_lowerBound,
+    a.m_lowerBound * b.m_upperBound,
+    a.m_upperBound * b.m_lowerBound,
+    a.m_upperBound * b.m_upperBound
+  };
+  float lowerBound = INFINITY, upperBound = -INFINITY;
+  for (float p : products) {
+    if (std::isnan(p)) {
+      // 0 × ∞ : one of the bounds is not a value of the expression.
+      return Interval(-INFINITY, INFINITY, isContinuous);
+    }
+    lowerBound = std::min(lowerBound, p);
+    upperBound = std::max(upperBound, p);
+  }
+  return Rounded(lowerBound, upperBound, isContinuous, k_arithmeticRelativeError);
+}
+
+Interval Interval::Inverse(Interval a) {
+  if (a.isEmpty() || (a.m_lowerBound == 0.0f && a.m_upperBound == 0.0f)) {
+    return Empty();
+  }
+  if (a.m_lowerBound > 0.0f || a.m_upperBound < 0.0f) {
+    return Rounded(1.0f / a.m_upperBound, 1.0f / a.m_lowerBound, a.m_isContinuous, k_arithmeticRelativeError);
+  }
+  // The expression is undefined at 0, the pole might be a bound.
+  if (a.m_lowerBound == 0.0f) {
+    return Rounded(1.0f / a.m_upperBound, INFINITY, false, k_arithmeticRelativeError);
+  }
+  if (a.m_upperBound == 0.0f) {
+    return Rounded(-INFINITY, 1.0f / a.m_lowerBound, false, k_arithmeticRelativeError);
+  }
+  return Unbounded();
+}
+
+Interval Interval::Power(Interval base, Interval exponent) {
+  if (base.isEmpty() || exponent.isEmpty()) {
+    return Empty();
+  }
+  if (exponent.isPoint()) {
+    constexpr float maxIntegerExponent = 1000.0f;
+    const float e = exponent.m_lowerBound;
+    if (e == std::round(e) && std::fabs(e) <= maxIntegerExponent) {
+      return IntegerPower(base, static_cast<int>(e));
+    }
+    if (e == 0.5f) {
+      return SquareRoot(base);
+    }
+  }
+  /* On positive bases, the power is monotonous with regard to both the base
+   * and the exponent, so that the extrema are reached on the corners. Other
+   * bases either have no real powers or real roots that depend on the complex
+   * format. */
+  if (base.m_lowerBound > 0.0f || (base.m_lowerBound == 0.0f && exponent.m_lowerBound > 0.0f)) {
+    const double corners[] = {
+      std::pow(static_cast<double>(base.m_lowerBound), static_cast<double>(exponent.m_lowerBound)),
+      std::pow(static_cast<double>(base.m_lowerBound), static_cast<double>(exponent.m_upperBound)),
+      std::pow(static_cast<double>(base.m_upperBound), static_cast<double>(exponent.m_lowerBound)),
+      std::pow(static_cast<double>(base.m_upperBound), static_cast<double>(exponent.m_upperBound))
+    };
+    double lowerBound = INFINITY, upperBound = -INFINITY;
+    for (double c : corners) {
+      if (std::isnan(c)) {
+        return Interval(-INFINITY, INFINITY, base.m_isContinuous && exponent.m_isContinuous);
+      }
+      lowerBound = std::min(lowerBound, c);
+      upperBound = std::max(upperBound, c);
+    }
+    return Rounded(lowerBound, upperBound, base.m_isContinuous && exponent.m_isContinuous, k_transcendentalRelativeError);
+  }
+  return Unbounded();
+}
+
+Interval Interval::SquareRoot(Interval a) {
+  if (a.isEmpty() || a.m_upperBound < 0.0f) {
+    return Empty();
+  }
+  return Rounded(std::sqrt(std::max(a.m_lowerBound, 0.0f)), std::sqrt(a.m_upperBound), a.m_isContinuous && a.m_lowerBound >= 0.0f, k_arithmeticRelativeError);
+}
+
+Interval Interval::NaperianLogarithm(Interval a) {
+  if (a.isEmpty() || a.m_upperBound <= 0.0f) {
+    return Empty();
+  }
+  const bool isDefined = a.m_lowerBound > 0.0f;
+  return Rounded(isDefined ? std::log(a.m_lowerBound) : -INFINITY, std::log(a.m_upperBound), a.m_isContinuous && isDefined, k_transcendentalRelativeError);
+}
+
+Interval Interval::AbsoluteValue(Interval a) {
+  if (a.isEmpty() || a.m_lowerBound >= 0.0f) {
+    return a;
+  }
+  if (a.m_upperBound <= 0.0f) {
+    return Opposite(a);
+  }
+  return Interval(0.0f, std::max(-a.m_lowerBound, a.m_upperBound), a.m_isContinuous);
+}
+
+Interval Interval::Sine(Interval a, Preferences::AngleUnit angleUnit) {
+  if (angleUnit != Preferences::AngleUnit::Radian) {
+    a = Multiply(a, Value(M_PI / Trigonometry::PiInAngleUnit(angleUnit)));
+  }
+  return SineInRadian(a);
+}
+
+Interval Interval::Cosine(Interval a, Preferences::AngleUnit angleUnit) {
+  if (angleUnit != Preferences::AngleUnit::Radian) {
+    a = Multiply(a, Value(M_PI / Trigonometry::PiInAngleUnit(angleUnit)));
+  }
+  return SineInRadian(Add(a, Value(M_PI_2)));
+}
+
+// Private
+
+Interval Interval::Rounded(float lowerBound, float upperBound, bool isContinuous, float relativeError) {
+  // NaN bounds come from ∞ - ∞ and the like : nothing is known.
+  lowerBound = std::isnan(lowerBound) ? -INFINITY : lowerBound - std::fabs(lowerBound) * relativeError;
+  upperBound = std::isnan(upperBound) ? INFINITY : upperBound + std::fabs(upperBound) * relativeError;
+  return Interval(lowerBound, upperBound, isContinuous);
+}
+
+Interval Interval::IntegerPower(Interval a, int n) {
+  if (n == 0) {
+    // 0^0 is undefined
+    return Interval(1.0f, 1.0f, a.m_isContinuous && (a.m_lowerBound > 0.0f || a.m_upperBound < 0.0f));
+  }
+  if (n < 0) {
+    return Inverse(IntegerPower(a, -n));
+  }
+  const double lowerPower = std::pow(static_cast<double>(a.m_lowerBound), n);
+  const double upperPower = std::pow(static_cast<double>(a.m_upperBound), n);
+  if (n % 2 == 1 || a.m_lowerBound >= 0.0f) {
+    return Rounded(lowerPower, upperPower, a.m_isContinuous, k_arithmeticRelativeError);
+  }
+  if (a.m_upperBound <= 0.0f) {
+    return Rounded(upperPower, lowerPower, a.m_isContinuous, k_arithmeticRelativeError);
+  }
+  return Rounded(0.0f, std::max(lowerPower, upperPower), a.m_isContinuous, k_arithmeticRelativeError);
+}
+
+Interval Interval::SineInRadian(Interval a) {
+  if (a.isEmpty()) {
+    return Empty();
+  }
+  const double lowerBound = a.m_lowerBound, upperBound = a.m_upperBound;
+  if (!(std::fabs(lowerBound) < k_maxTrigonometricArgument && std::fabs(upperBound) < k_maxTrigonometricArgument) || upperBound - lowerBound >= 2.0 * M_PI) {
+    return Interval(-1.0f, 1.0f, a.m_isContinuous);
+  }
+  double sineMin = std::min(std::sin(lowerBound), std::sin(upperBound));
+  double sineMax = std::max(std::sin(lowerBound), std::sin(upperBound));
+  // The extrema are reached on π/2 + 2kπ and -π/2 + 2kπ.
+  if (M_PI_2 + 2.0 * M_PI * std::ceil((lowerBound - M_PI_2) / (2.0 * M_PI)) <= upperBound) {
+    sineMax = 1.0;
+  }
+  if (-M_PI_2 + 2.0 * M_PI * std::ceil((lowerBound + M_PI_2) / (2.0 * M_PI)) <= upperBound) {
+    sineMin = -1.0;
+  }
+  return Interval(std::max(-1.0, sineMin - k_transcendentalRelativeError), std::min(1.0, sineMax + k_transcendentalRelativeError), a.m_isContinuous);
+}
+
+}
@@ -1,4 +1,5 @@
 #include <poincare/layout.h>
+#include <poincare/code_point_layout.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/layout_cursor.h>
 #include <poincare/layout.h>
@@ -19,24 +20,97 @@ bool LayoutNode::isIdenticalTo(Layout l) {
 
 // Rendering
 
+/* Adjacent code point layouts drawn with the same font and background are
+ * gathered and drawn by a single drawString. */
+class CodePointRun {
+public:
+  CodePointRun() : m_length(0), m_origin(KDPointZero), m_end(KDPointZero), m_font(nullptr), m_backgroundColor(KDColorWhite) {}
+  static bool CanBeDrawnInRun(CodePointLayoutNode * l) {
+    CodePoint c = l->codePoint();
+    return c != UCodePointNull && c != UCodePointLineFeed && c != UCodePointTabulation && !c.isCombining();
+  }
+  void add(KDContext * ctx, CodePointLayoutNode * l, KDPoint origin, KDColor expressionColor, KDColor backgroundColor) {
+    if (m_length > 0 && (l->font() != m_font || backgroundColor != m_backgroundColor || origin != m_end || m_length + CodePoint::MaxCodePointCharLength >= k_bufferSize)) {
+      draw(ctx, expressionColor);
+    }
+    if (m_length == 0) {
+      m_origin = origin;
+      m_font = l->font();
+      m_backgroundColor = backgroundColor;
+    }
+    m_length += SerializationHelper::CodePoint(m_buffer + m_length, k_bufferSize - m_length, l->codePoint());
+    m_end = origin.translatedBy(KDPoint(l->layoutSize().width(), 0));
+  }
+  void draw(KDContext * ctx, KDColor expressionColor) {
+    if (m_length > 0) {
+      ctx->drawString(m_buffer, m_origin, m_font, expressionColor, m_backgroundColor);
+      m_length = 0;
+    }
+  }
+private:
+  constexpr static int k_bufferSize = 64;
+  char m_buffer[k_bufferSize];
+  int m_length;
+  KDPoint m_origin;
+  KDPoint m_end;
+  const KDFont * m_font;
+  KDColor m_backgroundColor;
+};
+
 void LayoutNode::draw(KDContext * ctx, KDPoint p, KDColor expressionColor, KDColor backgroundColor, Layout * selectionStart, Layout * selectionEnd, KDColor selectionColor) {
-  bool isSelected = selectionStart != nullptr && selectionEnd != nullptr
-    && !selectionStart->isUninitialized() && !selectionStart->isUninitialized()
-    && reinterpret_cast<char *>(this) >= reinterpret_cast<char *>(selectionStart->node())
-    && reinterpret_cast<char *>(this) <= reinterpret_cast<char *>(selectionEnd->node());
-  KDColor backColor = isSelected ? selectionColor : backgroundColor;
-  KDPoint renderingAbsoluteOrigin = absoluteOrigin().translatedBy(p);
-  ctx->fillRect(KDRect(renderingAbsoluteOrigin, layoutSize()), backColor);
+  absoluteOrigin();
+  // Only the part of the layout inside the context's clipping rect is drawn
+  KDRect clippingRect = ctx->clippingRect().translatedBy(ctx->origin().opposite());
+  drawSubtree(ctx, p, clippingRect, expressionColor, backgroundColor, false, selectionStart, selectionEnd, selectionColor);
+}
+
+bool LayoutNode::isSelected(Layout * selectionStart, Layout * selectionEnd) const {
+  return selectionStart != nullptr && selectionEnd != nullptr
+    && !selectionStart->isUninitialized() && !selectionEnd->isUninitialized()
+    && reinterpret_cast<const char *>(this) >= reinterpret_cast<char *>(selectionStart->node())
+    && reinterpret_cast<const char *>(this) <= reinterpret_cast<char *>(selectionEnd->node());
+}
+
+void LayoutNode::drawSubtree(KDContext * ctx, KDPoint p, KDRect clippingRect, KDColor expressionColor, KDColor backgroundColor, bool backgroundIsFilled, Layout * selectionStart, Layout * selectionEnd, KDColor selectionColor) {
+  assert(m_positioned);
+  KDPoint renderingAbsoluteOrigin = m_frame.origin().translatedBy(p);
+  KDRect renderingFrame(renderingAbsoluteOrigin, layoutSize());
+  if (!renderingFrame.intersects(clippingRect)) {
+    return;
+  }
+  bool selected = isSelected(selectionStart, selectionEnd);
+  KDColor backColor = selected ? selectionColor : backgroundColor;
+  /* The parent filled the frame of its children with backgroundColor, so only
+   * a background of another color needs to be filled. */
+  if (!backgroundIsFilled || backColor != backgroundColor) {
+    ctx->fillRect(renderingFrame, backColor);
+  }
   render(ctx, renderingAbsoluteOrigin, expressionColor, backColor, selectionStart, selectionEnd, selectionColor);
-  if (!isSelected) {
-    for (LayoutNode * l : children()) {
-      l->draw(ctx, p, expressionColor, backgroundColor, selectionStart, selectionEnd, selectionColor);
-    }
-  } else {
-    for (LayoutNode * l : children()) {
-      l->draw(ctx, p, expressionColor, selectionColor);
+  if (selected) {
+    // The descendants of a selected layout are drawn on the selection color
+    selectionStart = nullptr;
+    selectionEnd = nullptr;
+  }
+  CodePointRun run;
+  LayoutNode * previousChild = nullptr;
+  KDPoint childPosition = KDPointZero;
+  for (LayoutNode * l : children()) {
+    childPosition = positionOfChildAfter(l, previousChild, childPosition);
+    previousChild = l;
+    l->m_frame.setOrigin(m_frame.origin().translatedBy(childPosition));
+    l->m_positioned = true;
+    if (l->type() == Type::CodePointLayout && CodePointRun::CanBeDrawnInRun(static_cast<CodePointLayoutNode *>(l))) {
+      KDPoint childOrigin = l->m_frame.origin().translatedBy(p);
+      if (KDRect(childOrigin, l->layoutSize()).intersects(clippingRect)) {
+        // The glyphs cover their whole frame, which needs no filling
+        run.add(ctx, static_cast<CodePointLayoutNode *>(l), childOrigin, expressionColor, l->isSelected(selectionStart, selectionEnd) ? selectionColor : backColor);
+      }
+      continue;
     }
+    run.draw(ctx, expressionColor);
+    l->drawSubtree(ctx, p, clippingRect, expressionColor, backColor, true, selectionStart, selectionEnd, selectionColor);
   }
+  run.draw(ctx, expressionColor);
 }
 
 KDPoint LayoutNode::absoluteOrigin() {
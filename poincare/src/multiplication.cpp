@@ -243,6 +243,14 @@ bool MultiplicationNode::derivate(ReductionContext reductionContext, Expression
   return Multiplication(this).derivate(reductionContext, symbol, symbolValue);
 }
 
+Interval MultiplicationNode::approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const {
+  Interval result = childAtIndex(0)->approximateOnInterval(symbol, x, angleUnit);
+  for (int i = 1; i < numberOfChildren(); i++) {
+    result = Interval::Multiply(result, childAtIndex(i)->approximateOnInterval(symbol, x, angleUnit));
+  }
+  return result;
+}
+
 /* Multiplication */
 
 int Multiplication::getPolynomialCoefficients(Context * context, const char * symbolName, Expression coefficients[], ExpressionNode::SymbolicComputation symbolicComputation) const {
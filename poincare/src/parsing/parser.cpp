@@ -7,6 +7,7 @@
 namespace Poincare {
 
 constexpr const Expression::FunctionHelper * Parser::s_reservedFunctions[];
+constexpr const char * Parser::s_specialIdentifierNames[];
 
 Expression Parser::parse() {
   Expression result = parseUntil(Token::EndOfStream);
@@ -25,34 +26,25 @@ bool Parser::IsReservedName(const char * name, size_t nameLength) {
 // Private
 
 const Expression::FunctionHelper * const * Parser::GetReservedFunction(const char * name, size_t nameLength) {
-  const Expression::FunctionHelper * const * reservedFunction = s_reservedFunctions;
-  while (reservedFunction < s_reservedFunctionsUpperBound) {
-    int nameDifference = Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name());
-    if (nameDifference == 0) {
-      return reservedFunction;
-    }
-    if (nameDifference < 0) {
-      break;
-    }
-    reservedFunction++;
+  static_assert(ReservedFunctionsAreOrdered(s_reservedFunctions, s_reservedFunctionsUpperBound), "Reserved functions must be ordered according to name");
+  const Expression::FunctionHelper * const * reservedFunction = std::lower_bound(s_reservedFunctions, s_reservedFunctionsUpperBound, name,
+      [nameLength](const Expression::FunctionHelper * helper, const char * name) {
+        return Token::CompareNonNullTerminatedName(name, nameLength, helper->name()) > 0;
+      });
+  if (reservedFunction < s_reservedFunctionsUpperBound && Token::CompareNonNullTerminatedName(name, nameLength, (**reservedFunction).name()) == 0) {
+    return reservedFunction;
   }
   return nullptr;
 }
 
 bool Parser::IsSpecialIdentifierName(const char * name, size_t nameLength) {
   // TODO Avoid special cases if possible
-  return (
-    Token::CompareNonNullTerminatedName(name, nameLength, Symbol::k_ans)     == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Infinity::Name())  == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "inf")             == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "infinity")        == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "oo")              == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Undefined::Name()) == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, Unreal::Name())    == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "u")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "v")               == 0 ||
-    Token::CompareNonNullTerminatedName(name, nameLength, "w")               == 0
-  );
+  static_assert(NamesAreStrictlyOrdered(s_specialIdentifierNames, s_specialIdentifierNamesUpperBound), "Special identifier names must be ordered and unique");
+  const char * const * specialIdentifierName = std::lower_bound(s_specialIdentifierNames, s_specialIdentifierNamesUpperBound, name,
+      [nameLength](const char * specialName, const char * name) {
+        return Token::CompareNonNullTerminatedName(name, nameLength, specialName) > 0;
+      });
+  return specialIdentifierName < s_specialIdentifierNamesUpperBound && Token::CompareNonNullTerminatedName(name, nameLength, *specialIdentifierName) == 0;
 }
 
 Expression Parser::parseUntil(Token::Type stoppingType) {
@@ -156,7 +148,11 @@ void Parser::parseNumber(Expression & leftHandSide, Token::Type stoppingType) {
     m_status = Status::Error; //FIXME
     return;
   }
-  leftHandSide = m_currentToken.expression();
+  if (m_currentToken.is(Token::Number)) {
+    leftHandSide = Number::ParseNumber(m_currentToken.text(), m_currentToken.length(), m_currentToken.fractionalPartText(), m_currentToken.fractionalPartLength(), m_currentToken.exponentIsNegative(), m_currentToken.exponentPartText(), m_currentToken.exponentPartLength());
+  } else {
+    leftHandSide = BasedInteger::Builder(m_currentToken.text(), m_currentToken.length(), m_currentToken.is(Token::BinaryNumber) ? Integer::Base::Binary : Integer::Base::Hexadecimal);
+  }
    // No implicit multiplication between two numbers
   if (m_nextToken.isNumber()
        // No implicit multiplication between a hexadecimal number and an identifer (avoid parsing 0x2abch as 0x2ABC*h)
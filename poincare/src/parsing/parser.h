@@ -159,10 +159,38 @@ private:
     &SquareRoot::s_functionHelper
   };
   static constexpr const Expression::FunctionHelper * const * s_reservedFunctionsUpperBound = s_reservedFunctions + (sizeof(s_reservedFunctions)/sizeof(Expression::FunctionHelper *));
-  /* The method GetReservedFunction passes through the successive
-   * entries of the above array in order to determine whether m_currentToken
-   * corresponds to an entry. As a helper, the static constexpr
-   * s_reservedFunctionsUpperBound marks the end of the array. */
+  /* The method GetReservedFunction looks m_currentToken up in the above array
+   * by binary search and returns its first entry with that name. As a helper,
+   * the static constexpr s_reservedFunctionsUpperBound marks the end of the
+   * array. The array order is checked at compile time in parser.cpp. */
+
+  // The array of special identifiers' names, also looked up by binary search
+  static constexpr const char * s_specialIdentifierNames[] = {
+    // Ordered according to name
+    Symbol::k_ans,
+    "inf",
+    "infinity",
+    "oo",
+    "u",
+    Undefined::Name(),
+    Unreal::Name(),
+    "v",
+    "w",
+    Infinity::Name()
+  };
+  static constexpr const char * const * s_specialIdentifierNamesUpperBound = s_specialIdentifierNames + (sizeof(s_specialIdentifierNames)/sizeof(const char *));
+
+  /* Compile-time helpers checking the order of the above arrays. Names are
+   * compared as unsigned bytes, like strcmp and strncmp do. */
+  static constexpr int CompareNames(const char * name1, const char * name2) {
+    return (*name1 != *name2 || *name1 == 0) ? static_cast<unsigned char>(*name1) - static_cast<unsigned char>(*name2) : CompareNames(name1 + 1, name2 + 1);
+  }
+  static constexpr bool ReservedFunctionsAreOrdered(const Expression::FunctionHelper * const * begin, const Expression::FunctionHelper * const * end) {
+    return end - begin < 2 || (CompareNames((**begin).name(), (**(begin + 1)).name()) <= 0 && ReservedFunctionsAreOrdered(begin + 1, end));
+  }
+  static constexpr bool NamesAreStrictlyOrdered(const char * const * begin, const char * const * end) {
+    return end - begin < 2 || (CompareNames(*begin, *(begin + 1)) < 0 && NamesAreStrictlyOrdered(begin + 1, end));
+  }
 };
 
 }
@@ -7,8 +7,11 @@
  * While processing a text input, the Tokenizer indeed produces (pops)
  * the successive Tokens, that are then consumed by the Parser.
  * Each Token has a Type and may hold other relevant data intended for the Parser:
- *   - an Expression, specifically for a Number Token,
- *   - a string (m_text, m_length), specifically for an Identifier Token. */
+ *   - the parts of a number (integral, fractional and exponent parts), for a
+ *     Number Token; the Parser builds the number when it consumes the Token,
+ *     so that the Tokenizer never allocates anything in the TreePool,
+ *   - a string (m_text, m_length), specifically for an Identifier Token, and
+ *     for the digits of a BinaryNumber or HexadecimalNumber Token. */
 
 namespace Poincare {
 
@@ -56,23 +59,45 @@ public:
     Undefined
   };
 
-  Token(Type type) : m_type(type), m_text(0), m_codePoint(UCodePointNull) {};
+  Token(Type type) :
+    m_type(type),
+    m_text(0),
+    m_length(0),
+    m_fractionalPartText(0),
+    m_fractionalPartLength(0),
+    m_exponentPartText(0),
+    m_exponentPartLength(0),
+    m_exponentIsNegative(false),
+    m_codePoint(UCodePointNull) {};
 
   Type type() const { return m_type; }
   bool is(Type t) const { return m_type == t; }
   bool isNumber() const { return m_type == Type::Number || m_type == Type::BinaryNumber || m_type == HexadecimalNumber; }
   bool isEndOfStream() const { return is(Type::EndOfStream); }
 
-  Expression expression() const { return m_expression; }
   const char * text() const { return m_text; }
   size_t length() const { return m_length; }
+  const char * fractionalPartText() const { return m_fractionalPartText; }
+  size_t fractionalPartLength() const { return m_fractionalPartLength; }
+  const char * exponentPartText() const { return m_exponentPartText; }
+  size_t exponentPartLength() const { return m_exponentPartLength; }
+  bool exponentIsNegative() const { return m_exponentIsNegative; }
   CodePoint codePoint() const { return m_codePoint; }
 
-  void setExpression(Expression e) { m_expression = e; }
   void setString(const char * text, size_t length) {
     m_text = text;
     m_length = length;
   }
+  // The integral part of a Number Token is its string
+  void setFractionalPart(const char * text, size_t length) {
+    m_fractionalPartText = text;
+    m_fractionalPartLength = length;
+  }
+  void setExponentPart(const char * text, size_t length, bool isNegative) {
+    m_exponentPartText = text;
+    m_exponentPartLength = length;
+    m_exponentIsNegative = isNegative;
+  }
   void setCodePoint(CodePoint c) { m_codePoint = c; }
   static int CompareNonNullTerminatedName(const char * nonNullTerminatedName, size_t nonNullTerminatedNameLength, const char * nullTerminatedName) {
     /* Compare m_text to name, similarly to strcmp, assuming
@@ -87,9 +112,13 @@ public:
   }
 private:
   Type m_type;
-  Expression m_expression;
   const char * m_text;
   size_t m_length;
+  const char * m_fractionalPartText;
+  size_t m_fractionalPartLength;
+  const char * m_exponentPartText;
+  size_t m_exponentPartLength;
+  bool m_exponentIsNegative;
   CodePoint m_codePoint;
 };
 
@@ -1,6 +1,4 @@
 #include "tokenizer.h"
-#include <poincare/based_integer.h>
-#include <poincare/number.h>
 #include <ion/unicode/utf8_decoder.h>
 
 namespace Poincare {
@@ -80,7 +78,7 @@ Token Tokenizer::popNumber() {
         return Token(Token::Undefined);
       }
       Token result(Token::BinaryNumber);
-      result.setExpression(BasedInteger::Builder(binaryText, binaryLength, Integer::Base::Binary));
+      result.setString(binaryText, binaryLength);
       return result;
     }
     // Look for "0x"
@@ -91,7 +89,7 @@ Token Tokenizer::popNumber() {
         return Token(Token::Undefined);
       }
       Token result(Token::HexadecimalNumber);
-      result.setExpression(BasedInteger::Builder(hexaText, hexaLength, Integer::Base::Hexadecimal));
+      result.setString(hexaText, hexaLength);
       return result;
     }
   }
@@ -120,7 +118,9 @@ Token Tokenizer::popNumber() {
   }
 
   Token result(Token::Number);
-  result.setExpression(Number::ParseNumber(integralPartText, integralPartLength, fractionalPartText, fractionalPartLength, exponentIsNegative, exponentPartText, exponentPartLength));
+  result.setString(integralPartText, integralPartLength);
+  result.setFractionalPart(fractionalPartText, fractionalPartLength);
+  result.setExponentPart(exponentPartText, exponentPartLength, exponentIsNegative);
   return result;
 }
 
@@ -1,5 +1,6 @@
 #include <poincare/preferences.h>
 #include <poincare/print_float.h>
+#include <ion/thread_local.h>
 
 namespace Poincare {
 
@@ -19,7 +20,7 @@ Preferences::Preferences() :
 {}
 
 Preferences * Preferences::sharedPreferences() {
-  static Preferences preferences;
+  static ION_THREAD_LOCAL Preferences preferences;
   return &preferences;
 }
 
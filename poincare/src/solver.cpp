@@ -1,5 +1,6 @@
 #include <poincare/solver.h>
 #include <poincare/ieee754.h>
+#include <algorithm>
 #include <assert.h>
 #include <float.h>
 #include <cmath>
@@ -251,6 +252,62 @@ T Solver::CumulativeDistributiveInverseForNDefinedFunction(T * probability, Valu
   return k-1;
 }
 
+template<typename T>
+T Solver::CumulativeDistributiveInverseForNDefinedCumulativeFunction(T * probability, ValueAtAbscissa cumulativeEvaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+  T precision = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
+  assert(*probability <= (((T)1.0) - precision) && *probability >= precision);
+  (void) precision;
+  /* As in CumulativeDistributiveInverseForNDefinedFunction, cumulative values
+   * above k_maxProbability are considered equal to 1. */
+  auto cumulative = [&](int k) {
+    T value = cumulativeEvaluation(k, context, complexFormat, angleUnit, context1, context2, context3);
+    return value >= (T)k_maxProbability ? (T)1.0 : value;
+  };
+  // The cumulative distributive function is 0 below 0
+  int lower = -1;
+  T lowerValue = 0.0;
+  // Find an upper bound whose cumulative value reaches the probability
+  int upper = 0;
+  T upperValue = cumulative(upper);
+  while (upperValue < *probability) {
+    if (upper >= k_maxNumberOfOperations) {
+      *probability = (T)1.0;
+      return INFINITY;
+    }
+    lower = upper;
+    lowerValue = upperValue;
+    upper = std::min(2*upper + 1, k_maxNumberOfOperations);
+    upperValue = cumulative(upper);
+  }
+  if (std::isnan(upperValue)) {
+    *probability = NAN;
+    return NAN;
+  }
+  // Narrow down to the first abscissa whose cumulative value reaches it
+  while (upper - lower > 1) {
+    int middle = lower + (upper - lower)/2;
+    T middleValue = cumulative(middle);
+    if (std::isnan(middleValue)) {
+      *probability = NAN;
+      return NAN;
+    }
+    if (middleValue < *probability) {
+      lower = middle;
+      lowerValue = middleValue;
+    } else {
+      upper = middle;
+      upperValue = middleValue;
+    }
+  }
+  // Return the abscissa whose cumulative value is the closest to the probability
+  if (upperValue - *probability <= *probability - lowerValue) {
+    *probability = upperValue;
+    return upper;
+  }
+  *probability = lowerValue;
+  return lower;
+}
+
 template<typename T>
 T Solver::CumulativeDistributiveFunctionForNDefinedFunction(T x, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
   int end = std::round(x);
@@ -271,6 +328,8 @@ T Solver::CumulativeDistributiveFunctionForNDefinedFunction(T x, ValueAtAbscissa
 
 template float Solver::CumulativeDistributiveInverseForNDefinedFunction(float *, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
 template double Solver::CumulativeDistributiveInverseForNDefinedFunction(double *, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
+template float Solver::CumulativeDistributiveInverseForNDefinedCumulativeFunction(float *, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
+template double Solver::CumulativeDistributiveInverseForNDefinedCumulativeFunction(double *, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
 template float Solver::CumulativeDistributiveFunctionForNDefinedFunction(float, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
 template double Solver::CumulativeDistributiveFunctionForNDefinedFunction(double, ValueAtAbscissa, Context *, Preferences::ComplexFormat, Preferences::AngleUnit, const void *, const void *, const void *);
 
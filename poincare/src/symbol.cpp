@@ -100,6 +100,10 @@ Evaluation<T> SymbolNode::templatedApproximate(ApproximationContext approximatio
   return e.node()->approximate(T(), approximationContext);
 }
 
+Interval SymbolNode::approximateOnInterval(const char * symbol, Interval x, Preferences::AngleUnit angleUnit) const {
+  return strcmp(m_name, symbol) == 0 ? x : Interval::Unbounded();
+}
+
 bool SymbolNode::isUnknown() const {
   bool result = UTF8Helper::CodePointIs(m_name, UCodePointUnknown);
   if (result) {
@@ -11,7 +11,7 @@
 
 namespace Poincare {
 
-TreePool * TreePool::SharedStaticPool = nullptr;
+ION_THREAD_LOCAL TreePool * TreePool::SharedStaticPool = nullptr;
 
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
@@ -119,6 +119,11 @@ void * TreePool::alloc(size_t size) {
   }
   void * result = m_cursor;
   m_cursor += size;
+#if POINCARE_TREE_POOL_STATISTICS
+  if (static_cast<size_t>(m_cursor - buffer()) > m_highWaterMark) {
+    m_highWaterMark = m_cursor - buffer();
+  }
+#endif
   return result;
 }
 
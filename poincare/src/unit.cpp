@@ -37,6 +37,8 @@ constexpr const UnitNode::InductanceRepresentative Unit::k_inductanceRepresentat
 constexpr const UnitNode::CatalyticActivityRepresentative Unit::k_catalyticActivityRepresentatives[];
 constexpr const UnitNode::SurfaceRepresentative Unit::k_surfaceRepresentatives[];
 constexpr const UnitNode::VolumeRepresentative Unit::k_volumeRepresentatives[];
+constexpr const UnitNode::Representative * Unit::k_representativesByRootSymbol[];
+constexpr size_t Unit::k_maxPrefixSymbolLength;
 
 constexpr const int
   Unit::k_emptyPrefixIndex,
@@ -294,25 +296,6 @@ int UnitNode::Representative::serialize(char * buffer, int bufferSize, const Pre
   return length;
 }
 
-bool UnitNode::Representative::canParseWithEquivalents(const char * symbol, size_t length, const Representative * * representative, const Prefix * * prefix) const {
-  const Representative * candidate = representativesOfSameDimension();
-  if (!candidate) {
-    return false;
-  }
-  for (int i = 0; i < numberOfRepresentatives(); i++) {
-    const char * rootSymbol = (candidate + i)->rootSymbol();
-    size_t rootSymbolLength = strlen(rootSymbol);
-    int potentialPrefixLength = length - rootSymbolLength;
-    if (potentialPrefixLength >= 0
-     && strncmp(rootSymbol, symbol + potentialPrefixLength, rootSymbolLength) == 0
-     && candidate[i].canParse(symbol, potentialPrefixLength, prefix)) {
-      *representative = (candidate + i);
-      return true;
-    }
-  }
-  return false;
-}
-
 bool UnitNode::Representative::canParse(const char * symbol, size_t length, const Prefix * * prefix) const {
   if (!isInputPrefixable()) {
     *prefix = Prefix::EmptyPrefix();
@@ -718,9 +701,71 @@ Unit Unit::Builder(const Unit::Representative * representative, const Prefix * p
   return static_cast<Unit &>(h);
 }
 
+static constexpr int compareSymbols(const char * s1, const char * s2) {
+  return (*s1 != *s2 || *s1 == '\0') ? static_cast<unsigned char>(*s1) - static_cast<unsigned char>(*s2) : compareSymbols(s1 + 1, s2 + 1);
+}
+
+static constexpr bool representativesAreOrdered(const Unit::Representative * const * begin, const Unit::Representative * const * end) {
+  return end - begin < 2 || (compareSymbols((*begin)->rootSymbol(), (*(begin + 1))->rootSymbol()) < 0 && representativesAreOrdered(begin + 1, end));
+}
+
+static constexpr size_t symbolLength(const char * symbol) {
+  return *symbol == '\0' ? 0 : 1 + symbolLength(symbol + 1);
+}
+
+static constexpr bool prefixesAreShorterThan(const Unit::Prefix * begin, const Unit::Prefix * end, size_t maxLength) {
+  return begin == end || (symbolLength(begin->symbol()) <= maxLength && prefixesAreShorterThan(begin + 1, end, maxLength));
+}
+
+static int compareRootSymbol(const char * rootSymbol, size_t length, const Unit::Representative * representative) {
+  // rootSymbol is not null-terminated
+  int diff = strncmp(rootSymbol, representative->rootSymbol(), length);
+  return diff != 0 ? diff : -static_cast<unsigned char>(representative->rootSymbol()[length]);
+}
+
 bool Unit::CanParse(const char * symbol, size_t length, const Unit::Representative * * representative, const Unit::Prefix * * prefix) {
-  for (int i = 0; i < Representative::k_numberOfDimensions; i++) {
-    if (Representative::DefaultRepresentatives()[i]->canParseWithEquivalents(symbol, length, representative, prefix)) {
+  constexpr const Representative * const * representativesEnd = k_representativesByRootSymbol + sizeof(k_representativesByRootSymbol) / sizeof(k_representativesByRootSymbol[0]);
+  static_assert(representativesAreOrdered(k_representativesByRootSymbol, representativesEnd), "Representatives must be ordered according to their root symbol");
+  static_assert(representativesEnd - k_representativesByRootSymbol ==
+      sizeof(k_timeRepresentatives) / sizeof(k_timeRepresentatives[0])
+      + sizeof(k_distanceRepresentatives) / sizeof(k_distanceRepresentatives[0])
+      + sizeof(k_massRepresentatives) / sizeof(k_massRepresentatives[0])
+      + sizeof(k_currentRepresentatives) / sizeof(k_currentRepresentatives[0])
+      + sizeof(k_temperatureRepresentatives) / sizeof(k_temperatureRepresentatives[0])
+      + sizeof(k_amountOfSubstanceRepresentatives) / sizeof(k_amountOfSubstanceRepresentatives[0])
+      + sizeof(k_luminousIntensityRepresentatives) / sizeof(k_luminousIntensityRepresentatives[0])
+      + sizeof(k_frequencyRepresentatives) / sizeof(k_frequencyRepresentatives[0])
+      + sizeof(k_forceRepresentatives) / sizeof(k_forceRepresentatives[0])
+      + sizeof(k_pressureRepresentatives) / sizeof(k_pressureRepresentatives[0])
+      + sizeof(k_energyRepresentatives) / sizeof(k_energyRepresentatives[0])
+      + sizeof(k_powerRepresentatives) / sizeof(k_powerRepresentatives[0])
+      + sizeof(k_electricChargeRepresentatives) / sizeof(k_electricChargeRepresentatives[0])
+      + sizeof(k_electricPotentialRepresentatives) / sizeof(k_electricPotentialRepresentatives[0])
+      + sizeof(k_electricCapacitanceRepresentatives) / sizeof(k_electricCapacitanceRepresentatives[0])
+      + sizeof(k_electricResistanceRepresentatives) / sizeof(k_electricResistanceRepresentatives[0])
+      + sizeof(k_electricConductanceRepresentatives) / sizeof(k_electricConductanceRepresentatives[0])
+      + sizeof(k_magneticFluxRepresentatives) / sizeof(k_magneticFluxRepresentatives[0])
+      + sizeof(k_magneticFieldRepresentatives) / sizeof(k_magneticFieldRepresentatives[0])
+      + sizeof(k_inductanceRepresentatives) / sizeof(k_inductanceRepresentatives[0])
+      + sizeof(k_catalyticActivityRepresentatives) / sizeof(k_catalyticActivityRepresentatives[0])
+      + sizeof(k_surfaceRepresentatives) / sizeof(k_surfaceRepresentatives[0])
+      + sizeof(k_volumeRepresentatives) / sizeof(k_volumeRepresentatives[0]),
+      "All representatives must be listed in k_representativesByRootSymbol");
+  static_assert(prefixesAreShorterThan(k_prefixes, k_prefixes + Prefix::k_numberOfPrefixes, k_maxPrefixSymbolLength), "k_maxPrefixSymbolLength is incorrect");
+  /* The symbol is a prefix followed by a root symbol: try each possible prefix
+   * length and look the remaining root symbol up. No two pairs of a prefix and
+   * a representative share the same symbol, which is checked in the tests. */
+  for (size_t prefixLength = 0; prefixLength <= k_maxPrefixSymbolLength && prefixLength < length; prefixLength++) {
+    const char * rootSymbol = symbol + prefixLength;
+    size_t rootSymbolLength = length - prefixLength;
+    const Representative * const * candidate = std::lower_bound(k_representativesByRootSymbol, representativesEnd, rootSymbol,
+        [rootSymbolLength](const Representative * r, const char * rootSymbol) {
+          return compareRootSymbol(rootSymbol, rootSymbolLength, r) > 0;
+        });
+    if (candidate < representativesEnd
+     && compareRootSymbol(rootSymbol, rootSymbolLength, *candidate) == 0
+     && (*candidate)->canParse(symbol, prefixLength, prefix)) {
+      *representative = *candidate;
       return true;
     }
   }
@@ -0,0 +1,55 @@
+#include <poincare/interval.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+constexpr float IntervalTolerance = 1e-5f;
+
+static bool bound_is(float bound, float target) {
+  return (std::isinf(target) && bound == target) || std::fabs(bound - target) <= IntervalTolerance * (1.f + std::fabs(target));
+}
+
+void assert_interval_is(const char * definition, float xMin, float xMax, float targetLowerBound, float targetUpperBound, bool isContinuous, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(definition, &globalContext, false);
+  Interval result = e.approximateOnIntervalForSymbol("x", xMin, xMax, angleUnit);
+  bool match = std::isnan(targetLowerBound) ?
+    result.isEmpty() :
+    (result.lowerBound() <= targetLowerBound && result.upperBound() >= targetUpperBound && bound_is(result.lowerBound(), targetLowerBound) && bound_is(result.upperBound(), targetUpperBound) && result.isContinuous() == isContinuous);
+  quiz_assert_print_if_failure(match, definition);
+}
+
+QUIZ_CASE(poincare_interval_arithmetic) {
+  assert_interval_is("2", -1, 1, 2, 2, true);
+  assert_interval_is("x", -1, 2, -1, 2, true);
+  assert_interval_is("x+1", -1, 2, 0, 3, true);
+  assert_interval_is("2x-3", -1, 2, -5, 1, true);
+  assert_interval_is("x^2", -1, 2, 0, 4, true);
+  assert_interval_is("x^3", -1, 2, -1, 8, true);
+  assert_interval_is("abs(x)", -3, 2, 0, 3, true);
+  assert_interval_is("1/x", 1, 2, 0.5, 1, true);
+  assert_interval_is("1/x", 0, 2, 0.5, INFINITY, false);
+  assert_interval_is("1/x", -1, 1, -INFINITY, INFINITY, false);
+  assert_interval_is("x^(-2)", -2, -1, 0.25, 1, true);
+  assert_interval_is("1/(x-x)", 1, 2, -INFINITY, INFINITY, false);
+}
+
+QUIZ_CASE(poincare_interval_functions) {
+  assert_interval_is("√(x)", 1, 4, 1, 2, true);
+  assert_interval_is("√(x)", -1, 4, 0, 2, false);
+  assert_interval_is("√(x)", -2, -1, NAN, NAN, false);
+  assert_interval_is("ln(x)", 1, M_E, 0, 1, true);
+  assert_interval_is("ln(x)", 0, 1, -INFINITY, 0, false);
+  assert_interval_is("log(x)", 1, 100, 0, 2, true);
+  assert_interval_is("ℯ^x", 0, 1, 1, M_E, true);
+  assert_interval_is("2^x", -1, 3, 0.5, 8, true);
+  assert_interval_is("sin(x)", 0, 1, 0, 0.841470985, true);
+  assert_interval_is("sin(x)", 0, 4, -0.756802495, 1, true);
+  assert_interval_is("cos(x)", -1, 4, -1, 1, true);
+  assert_interval_is("cos(x)", 0, 90, 0, 1, true, Degree);
+  assert_interval_is("sin(x)", -1e6, 1e6, -1, 1, true);
+  // Functions without interval approximation
+  assert_interval_is("floor(x)", 0, 1, -INFINITY, INFINITY, false);
+  assert_interval_is("x+floor(x)", 0, 1, -INFINITY, INFINITY, false);
+}
@@ -1,4 +1,5 @@
 #include <poincare_layouts.h>
+#include <kandinsky/framebuffer_context.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -165,3 +166,60 @@ QUIZ_CASE(poincare_layout_parentheses_size) {
   layout.addChildAtIndex(CodePointLayout::Builder('1'), 8, 8, nullptr);
   quiz_assert(leftPar.layoutSize().height() == rightPar.layoutSize().height());
 }
+
+class CountingContext : public KDFrameBufferContext {
+public:
+  CountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  int numberOfPushes() const { return m_numberOfPushes; }
+protected:
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRectUniform(rect, color);
+  }
+private:
+  int m_numberOfPushes;
+};
+
+QUIZ_CASE(poincare_layout_draw) {
+  constexpr int numberOfCodePoints = 3;
+  const KDFont * font = KDFont::LargeFont;
+  const KDSize glyphSize = font->glyphSize();
+  constexpr int maxNumberOfPixels = numberOfCodePoints * 12 * 20;
+  const KDSize size(numberOfCodePoints * glyphSize.width(), glyphSize.height());
+  const int numberOfPixels = size.width() * size.height();
+  quiz_assert(numberOfPixels <= maxNumberOfPixels);
+  KDColor pixels[maxNumberOfPixels];
+  KDColor expectedPixels[maxNumberOfPixels];
+  KDFrameBuffer frameBuffer(pixels, size);
+  KDFrameBuffer expectedFrameBuffer(expectedPixels, size);
+  CountingContext context(&frameBuffer);
+  CountingContext expectedContext(&expectedFrameBuffer);
+
+  /* The code points of a horizontal layout are drawn as one string, over the
+   * background filled once */
+  Layout layout = LayoutHelper::String("1+2", numberOfCodePoints);
+  layout.draw(&context, KDPointZero, KDColorBlack, KDColorWhite);
+  quiz_assert(context.numberOfPushes() == 1 + numberOfCodePoints);
+  expectedContext.drawString("1+2", KDPointZero, font, KDColorBlack, KDColorWhite);
+  for (int i = 0; i < numberOfPixels; i++) {
+    quiz_assert(pixels[i] == expectedPixels[i]);
+  }
+
+  // A selected code point is drawn on the selection color
+  Layout selection = layout.childAtIndex(1);
+  layout.draw(&context, KDPointZero, KDColorBlack, KDColorWhite, &selection, &selection, KDColorRed);
+  expectedContext.drawString("+", KDPoint(glyphSize.width(), 0), font, KDColorBlack, KDColorRed);
+  for (int i = 0; i < numberOfPixels; i++) {
+    quiz_assert(pixels[i] == expectedPixels[i]);
+  }
+
+  // Layouts outside the clipping rect are not drawn
+  int numberOfPushes = context.numberOfPushes();
+  context.setClippingRect(KDRect(KDPointZero, glyphSize));
+  layout.draw(&context, KDPointZero, KDColorBlack, KDColorWhite);
+  quiz_assert(context.numberOfPushes() == numberOfPushes + 2);
+}
@@ -4,6 +4,7 @@
 #include <apps/shared/global_context.h>
 #include "tree/helpers.h"
 #include "helper.h"
+#include <string.h>
 
 using namespace Poincare;
 
@@ -297,10 +298,18 @@ QUIZ_CASE(poincare_parsing_units) {
       quiz_assert_print_if_failure(unit.type() == ExpressionNode::Type::Unit, "Should be parsed as a Unit");
       if (rep->isInputPrefixable()) {
         for (size_t i = 0; i < Unit::Prefix::k_numberOfPrefixes; i++) {
-          const Unit::Prefix * pre = Unit::Prefix::Prefixes();
+          const Unit::Prefix * pre = Unit::Prefix::Prefixes() + i;
+          if (!rep->canPrefix(pre, true)) {
+            continue;
+          }
           Unit::Builder(rep, pre).serialize(buffer, bufferSize, Preferences::PrintFloatMode::Decimal, Preferences::VeryShortNumberOfSignificantDigits);
           Expression unit = parse_expression(buffer, nullptr, false);
           quiz_assert_print_if_failure(unit.type() == ExpressionNode::Type::Unit, "Should be parsed as a Unit");
+          // Each pair of a prefix and a representative has its own symbol
+          const Unit::Representative * parsedRepresentative = nullptr;
+          const Unit::Prefix * parsedPrefix = nullptr;
+          quiz_assert(Unit::CanParse(buffer + 1, strlen(buffer + 1), &parsedRepresentative, &parsedPrefix));
+          quiz_assert_print_if_failure(parsedRepresentative == rep && parsedPrefix == pre, buffer);
         }
       }
     }
@@ -309,6 +318,9 @@ QUIZ_CASE(poincare_parsing_units) {
   // Non-existing units are not parsable
   assert_text_not_parsable("_n");
   assert_text_not_parsable("_a");
+  assert_text_not_parsable("_mmin");
+  assert_text_not_parsable("_mt");
+  assert_text_not_parsable("_kmin");
 
   // Any identifier starting with '_' is tokenized as a unit
   assert_tokenizes_as_unit("_m");
@@ -501,3 +513,85 @@ QUIZ_CASE(poincare_parsing_adding_missing_parentheses) {
   assert_parsed_expression_with_user_parentheses_is("-conj(2+3)", Opposite::Builder(Parenthesis::Builder(Conjugate::Builder(Addition::Builder(BasedInteger::Builder(2), BasedInteger::Builder(3))))));
   assert_parsed_expression_with_user_parentheses_is("conj(2+3)!", Factorial::Builder(Parenthesis::Builder(Conjugate::Builder(Addition::Builder(BasedInteger::Builder(2), BasedInteger::Builder(3))))));
 }
+
+static int number_of_leaves(Expression e) {
+  int numberOfChildren = e.numberOfChildren();
+  if (numberOfChildren == 0) {
+    return 1;
+  }
+  int result = 0;
+  for (int i = 0; i < numberOfChildren; i++) {
+    result += number_of_leaves(e.childAtIndex(i));
+  }
+  return result;
+}
+
+static int depth_along_first_children(Expression e) {
+  int result = 0;
+  while (e.numberOfChildren() > 0) {
+    e = e.childAtIndex(0);
+    result++;
+  }
+  return result;
+}
+
+static const char * repeated_input(char * buffer, size_t bufferSize, const char * prefix, const char * pattern, int numberOfRepetitions, const char * suffix) {
+  size_t length = strlcpy(buffer, prefix, bufferSize);
+  for (int i = 0; i < numberOfRepetitions; i++) {
+    length += strlcpy(buffer + length, pattern, bufferSize - length);
+  }
+  strlcpy(buffer + length, suffix, bufferSize - length);
+  quiz_assert(strlen(buffer) < bufferSize - 1);
+  return buffer;
+}
+
+QUIZ_CASE(poincare_parsing_long_inputs) {
+  constexpr size_t bufferSize = 2048;
+  char buffer[bufferSize];
+  char leftParentheses[bufferSize];
+
+  {
+    // Flattened sum
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "1", "+2", 200, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Addition && e.numberOfChildren() == 201);
+    quiz_assert(e.childAtIndex(200).isIdenticalTo(BasedInteger::Builder(2)));
+  }
+  {
+    // Left-associative subtraction
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "1", "-1", 200, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Subtraction && depth_along_first_children(e) == 200);
+  }
+  {
+    // Nested parentheses
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, repeated_input(leftParentheses, bufferSize, "", "(", 150, "π"), ")", 150, ""), nullptr);
+    quiz_assert(depth_along_first_children(e) == 150 && number_of_leaves(e) == 1);
+  }
+  {
+    // Implicit multiplications
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "2", "π", 150, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Multiplication && number_of_leaves(e) == 151);
+  }
+  {
+    // Long flattened sums and products
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "1", "+1", 299, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Addition && e.numberOfChildren() == 300);
+  }
+  {
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "2", "×3", 299, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Multiplication && e.numberOfChildren() == 300);
+  }
+  {
+    // Deep right-associative chain
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, "2", "^2", 299, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Power && number_of_leaves(e) == 300);
+  }
+  {
+    // Nested right operands
+    Expression e = Expression::Parse(repeated_input(buffer, bufferSize, repeated_input(leftParentheses, bufferSize, "", "1-(", 200, "1"), ")", 200, ""), nullptr);
+    quiz_assert(e.type() == ExpressionNode::Type::Subtraction && number_of_leaves(e) == 201);
+  }
+
+  // Errors discard the nodes built so far
+  assert_text_not_parsable(repeated_input(buffer, bufferSize, "1", "-2×3", 100, "+"));
+  assert_text_not_parsable(repeated_input(buffer, bufferSize, "1", "+1", 299, ")"));
+}
@@ -370,6 +370,30 @@ Q(KEY_EE)
 Q(KEY_ANS)
 Q(KEY_EXE)
 
+// Native emitter QSTRs
+Q(native)
+Q(viper)
+Q(ptr)
+Q(ptr8)
+Q(ptr16)
+Q(ptr32)
+Q(uint)
+Q(None)
+Q(ViperTypeError)
+
+// Typed arrays QSTRs
+Q(array)
+Q(bytearray)
+Q(memoryview)
+Q(struct)
+Q(pack)
+Q(pack_into)
+Q(unpack)
+Q(unpack_from)
+Q(calcsize)
+Q(itemsize)
+Q(readinto)
+
 // Kandinsky QSTRs
 Q(kandinsky)
 Q(color)
@@ -382,6 +406,31 @@ Q(large_font)
 Q(small_font)
 Q(wait_vblank)
 Q(get_keys)
+Q(set_pixels)
+Q(fill_rects)
+Q(blit)
+
+// Color names QSTRs
+Q(blue)
+Q(b)
+Q(red)
+Q(r)
+Q(green)
+Q(g)
+Q(yellow)
+Q(y)
+Q(brown)
+Q(black)
+Q(k)
+Q(white)
+Q(w)
+Q(pink)
+Q(orange)
+Q(purple)
+Q(gray)
+Q(grey)
+Q(cyan)
+Q(magenta)
 
 // Keys QSTRs
 Q(left)
@@ -473,6 +522,7 @@ Q(setheading)
 Q(seth)
 Q(circle)
 Q(speed)
+Q(tracer)
 Q(position)
 Q(pos)
 Q(heading)
@@ -5,6 +5,27 @@ extern "C" {
 #include "mphalport.h"
 }
 
+/* The VM hook is called at each backward branch. Reading the timer at each
+ * call would slow tight loops down, so the timer is only read every
+ * sNumberOfCallsBetweenTimerChecks calls. This number is tuned after each
+ * reading so that readings happen about every k_timerCheckPeriod ms: it is
+ * doubled when a reading comes early and halved as soon as one comes late, so
+ * that a loop whose iterations suddenly become slow is still interrupted
+ * promptly. When a reading comes after a whole polling period, the timer is
+ * read again at the next call. The number of calls is capped so that the
+ * timer is still read regularly in the cheapest loops. The keyboard is
+ * scanned, and the print output refreshed, every k_pollingPeriod ms. */
+
+static constexpr uint64_t k_pollingPeriod = 50;
+static constexpr uint64_t k_timerCheckPeriod = 5;
+static constexpr uint32_t k_maxNumberOfCallsBetweenTimerChecks = 512;
+
+static uint32_t sNumberOfCallsBetweenTimerChecks = 1;
+static uint32_t sNumberOfCallsBeforeTimerCheck = 1;
+static uint64_t sLastTimerCheck = 0;
+static uint64_t sLastPolling = 0;
+static micropython_port_vm_hook_statistics_t sStatistics = {0, 0, 0};
+
 bool micropython_port_vm_hook_loop() {
   /* This function is called very frequently by the MicroPython engine. We grab
    * this opportunity to interrupt execution and/or refresh the display on
@@ -12,21 +33,46 @@ bool micropython_port_vm_hook_loop() {
 
   /* Doing too many things here slows down Python execution quite a lot. So we
    * only do things once in a while and return as soon as possible otherwise. */
+  sStatistics.numberOfCalls++;
+  if (--sNumberOfCallsBeforeTimerCheck > 0) {
+    return false;
+  }
 
-  static uint64_t t = Ion::Timing::millis();
-  static constexpr uint64_t delay = 100;
+  sStatistics.numberOfTimerChecks++;
+  uint64_t t = Ion::Timing::millis();
+  uint64_t elapsed = t - sLastTimerCheck;
+  sLastTimerCheck = t;
+  if (elapsed >= k_pollingPeriod) {
+    sNumberOfCallsBetweenTimerChecks = 1;
+  } else if (elapsed > k_timerCheckPeriod) {
+    sNumberOfCallsBetweenTimerChecks = sNumberOfCallsBetweenTimerChecks > 1 ? sNumberOfCallsBetweenTimerChecks / 2 : 1;
+  } else if (elapsed < k_timerCheckPeriod / 2 && sNumberOfCallsBetweenTimerChecks < k_maxNumberOfCallsBetweenTimerChecks) {
+    sNumberOfCallsBetweenTimerChecks *= 2;
+  }
+  sNumberOfCallsBeforeTimerCheck = sNumberOfCallsBetweenTimerChecks;
 
-  uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
+  if (t - sLastPolling < k_pollingPeriod) {
     return false;
   }
-  t = t2;
+  sLastPolling = t;
 
+  sStatistics.numberOfPollings++;
   micropython_port_vm_hook_refresh_print();
   // Check if the user asked for an interruption from the keyboard
   return micropython_port_interrupt_if_needed();
 }
 
+void micropython_port_vm_hook_reset() {
+  sNumberOfCallsBetweenTimerChecks = 1;
+  sNumberOfCallsBeforeTimerCheck = 1;
+  sLastTimerCheck = Ion::Timing::millis();
+  sLastPolling = sLastTimerCheck;
+}
+
+micropython_port_vm_hook_statistics_t micropython_port_vm_hook_statistics() {
+  return sStatistics;
+}
+
 void micropython_port_vm_hook_refresh_print() {
   assert(MicroPython::ExecutionEnvironment::currentExecutionEnvironment() != nullptr);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->refreshPrintOutput();
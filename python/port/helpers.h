@@ -6,15 +6,31 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
+// Forget the timer tuning of the previous execution
+void micropython_port_vm_hook_reset();
+
+/* Counters of the VM hook calls, of the timer readings and of the keyboard
+ * scans they triggered, to measure the polling overhead. */
+typedef struct {
+  uint32_t numberOfCalls;
+  uint32_t numberOfTimerChecks;
+  uint32_t numberOfPollings;
+} micropython_port_vm_hook_statistics_t;
+micropython_port_vm_hook_statistics_t micropython_port_vm_hook_statistics();
+
 void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
 
+// Make code emitted by the native code emitter executable
+void * micropython_port_commit_exec(void * ptr, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
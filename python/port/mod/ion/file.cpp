@@ -67,6 +67,13 @@ const mp_obj_fun_builtin_var_t file_read_obj = {
     {(mp_fun_var_t)file_read}
 };
 
+STATIC mp_obj_t file_readinto(mp_obj_t o_in, mp_obj_t o_b);
+
+const mp_obj_fun_builtin_fixed_t file_readinto_obj = {
+  {&mp_type_fun_builtin_2},
+  {(mp_fun_0_t)file_readinto}
+};
+
 STATIC mp_obj_t file_write(mp_obj_t o_in, mp_obj_t o_s);
 
 const mp_obj_fun_builtin_fixed_t file_write_obj = {
@@ -306,6 +313,10 @@ STATIC void file_attr(mp_obj_t self_in, qstr attribute, mp_obj_t *destination) {
             destination[0] = (mp_obj_t) MP_ROM_PTR(&file_read_obj);
             destination[1] = self_in;
             break;
+        case MP_QSTR_readinto:
+            destination[0] = (mp_obj_t) MP_ROM_PTR(&file_readinto_obj);
+            destination[1] = self_in;
+            break;
         case MP_QSTR_readline:
             destination[0] = (mp_obj_t) MP_ROM_PTR(&file_readline_obj);
             destination[1] = self_in;
@@ -709,19 +720,22 @@ STATIC mp_obj_t file_write(mp_obj_t o_in, mp_obj_t o_s) {
         mp_raise_OSError(1);
     }
     
+    size_t len;
+    const char* buffer;
     if (file->binary_mode == TEXT) {
         if (!mp_obj_is_str(o_s)) {
             mp_raise_ValueError("s must be a str!");
         }
-    } else if (file->binary_mode == BINARY) {
-        if (!mp_obj_is_type(o_s, &mp_type_bytes)) {
-            mp_raise_ValueError("s must be a bytes!");
+        buffer = mp_obj_str_get_data(o_s, &len);
+    } else {
+        // Any bytes-like object (bytes, bytearray, array, memoryview) is written in place
+        mp_buffer_info_t bufinfo;
+        if (mp_obj_is_str(o_s) || !mp_get_buffer(o_s, &bufinfo, MP_BUFFER_READ)) {
+            mp_raise_ValueError("s must be a bytes-like object!");
         }
+        buffer = (const char*) bufinfo.buf;
+        len = bufinfo.len;
     }
-    
-    size_t len;
-    const char* buffer;
-    buffer = mp_obj_str_get_data(o_s, &len);
 
     size_t previous_size = file->record.value().size;
     
@@ -806,6 +820,38 @@ STATIC mp_obj_t __file_read_backend(file_obj_t* file, mp_int_t size, bool with_l
     return mp_const_none;
 }
 
+// Reads bytes directly into a writable bytes-like object, without allocating.
+STATIC mp_obj_t file_readinto(mp_obj_t o_in, mp_obj_t o_b) {
+    if(!mp_obj_is_type(o_in, &file_type)) {
+        mp_raise_TypeError("self must be a file!");
+    }
+
+    file_obj_t *file = (file_obj_t*) MP_OBJ_TO_PTR(o_in);
+
+    check_closed(file);
+
+    // Check mode
+    if (file->open_mode != READ && file->edit_mode != true) {
+        mp_raise_OSError(1);
+    }
+    if (file->binary_mode != BINARY) {
+        mp_raise_ValueError("readinto needs a binary file!");
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(o_b, &bufinfo, MP_BUFFER_WRITE);
+
+    size_t file_size = file->record.value().size;
+    size_t len = 0;
+    if (file->position < file_size) {
+        len = std::min(bufinfo.len, file_size - file->position);
+        memcpy(bufinfo.buf, (const uint8_t*)(file->record.value().buffer) + file->position, len);
+        file->position += len;
+    }
+
+    return mp_obj_new_int(len);
+}
+
 STATIC mp_obj_t file_read(size_t n_args, const mp_obj_t* args) {
     mp_arg_check_num(n_args, 0, 1, 2, false);
     
@@ -1,5 +1,6 @@
 extern "C" {
 #include "modkandinsky.h"
+#include <py/binary.h>
 #include <py/runtime.h>
 }
 #include <kandinsky.h>
@@ -100,6 +101,133 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
   return mp_const_none;
 }
 
+/* The batch primitives parse the colour and display the sandbox once for all
+ * the drawn items, which makes them much faster than a loop over the
+ * corresponding single item primitives. */
+
+/* set_pixels(points, color) takes either a list or tuple of (x, y) pairs, or
+ * a flat buffer of integer coordinates x0, y0, x1, y1... such as an
+ * array('h'), which is read in place. */
+
+mp_obj_t modkandinsky_set_pixels(mp_obj_t points, mp_obj_t input) {
+  mp_buffer_info_t bufferInfo;
+  if (!mp_obj_is_type(points, &mp_type_tuple) && !mp_obj_is_type(points, &mp_type_list) && mp_get_buffer(points, &bufferInfo, MP_BUFFER_READ)) {
+    if (bufferInfo.typecode == 'f' || bufferInfo.typecode == 'd') {
+      mp_raise_TypeError("coordinates must be integers");
+    }
+    size_t numberOfCoordinates = bufferInfo.len / mp_binary_get_size('@', bufferInfo.typecode, nullptr);
+    if (numberOfCoordinates % 2 != 0) {
+      mp_raise_ValueError("odd number of coordinates");
+    }
+    KDColor kdColor = MicroPython::Color::Parse(input);
+    MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+    KDContext * context = KDIonContext::sharedContext();
+    for (size_t i = 0; i < numberOfCoordinates; i += 2) {
+      mp_int_t x = mp_obj_get_int(mp_binary_get_val_array(bufferInfo.typecode, bufferInfo.buf, i));
+      mp_int_t y = mp_obj_get_int(mp_binary_get_val_array(bufferInfo.typecode, bufferInfo.buf, i + 1));
+      context->setPixel(KDPoint(x, y), kdColor);
+    }
+    return mp_const_none;
+  }
+  size_t numberOfPoints;
+  mp_obj_t * pointItems;
+  mp_obj_get_array(points, &numberOfPoints, &pointItems);
+  KDColor kdColor = MicroPython::Color::Parse(input);
+  // Check all the points before displaying the sandbox
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    mp_obj_t * coordinates;
+    mp_obj_get_array_fixed_n(pointItems[i], 2, &coordinates);
+    mp_obj_get_int(coordinates[0]);
+    mp_obj_get_int(coordinates[1]);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDContext * context = KDIonContext::sharedContext();
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    mp_obj_t * coordinates;
+    mp_obj_get_array_fixed_n(pointItems[i], 2, &coordinates);
+    context->setPixel(KDPoint(mp_obj_get_int(coordinates[0]), mp_obj_get_int(coordinates[1])), kdColor);
+  }
+  return mp_const_none;
+}
+
+static KDRect RectFromTuple(mp_obj_t tuple) {
+  mp_obj_t * items;
+  mp_obj_get_array_fixed_n(tuple, 4, &items);
+  mp_int_t x = mp_obj_get_int(items[0]);
+  mp_int_t y = mp_obj_get_int(items[1]);
+  mp_int_t width = mp_obj_get_int(items[2]);
+  mp_int_t height = mp_obj_get_int(items[3]);
+  if (width < 0) {
+    width = -width;
+    x = x - width;
+  }
+  if (height < 0) {
+    height = -height;
+    y = y - height;
+  }
+  return KDRect(x, y, width, height);
+}
+
+mp_obj_t modkandinsky_fill_rects(mp_obj_t rects, mp_obj_t input) {
+  size_t numberOfRects;
+  mp_obj_t * rectItems;
+  mp_obj_get_array(rects, &numberOfRects, &rectItems);
+  KDColor kdColor = MicroPython::Color::Parse(input);
+  // Check all the rects before displaying the sandbox
+  for (size_t i = 0; i < numberOfRects; i++) {
+    RectFromTuple(rectItems[i]);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDContext * context = KDIonContext::sharedContext();
+  for (size_t i = 0; i < numberOfRects; i++) {
+    context->fillRect(RectFromTuple(rectItems[i]), kdColor);
+  }
+  return mp_const_none;
+}
+
+/* blit(x, y, width, height, buffer) draws a width×height image whose pixels
+ * are given row by row in buffer, as little-endian RGB565 values. */
+
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t * args) {
+  mp_int_t x = mp_obj_get_int(args[0]);
+  mp_int_t y = mp_obj_get_int(args[1]);
+  mp_int_t width = mp_obj_get_int(args[2]);
+  mp_int_t height = mp_obj_get_int(args[3]);
+  mp_buffer_info_t bufferInfo;
+  mp_get_buffer_raise(args[4], &bufferInfo, MP_BUFFER_READ);
+  /* The expected size is computed in size_t, after checking that it does not
+   * overflow, so that huge dimensions cannot match a small buffer. */
+  if (width < 0 || height < 0
+      || (height > 0 && static_cast<size_t>(width) > SIZE_MAX / sizeof(KDColor) / static_cast<size_t>(height))
+      || bufferInfo.len != static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(KDColor)) {
+    mp_raise_ValueError("buffer size doesn't match width and height");
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDContext * context = KDIonContext::sharedContext();
+  // Only the pixels lying on the screen are read and pushed
+  const mp_int_t firstColumn = x < 0 ? -x : 0;
+  const mp_int_t lastColumn = width < Ion::Display::Width - x ? width : Ion::Display::Width - x;
+  const mp_int_t firstRow = y < 0 ? -y : 0;
+  const mp_int_t lastRow = height < Ion::Display::Height - y ? height : Ion::Display::Height - y;
+  /* The buffer is not necessarily aligned on KDColor: rows are copied in a
+   * line buffer before being pushed. */
+  KDColor line[Ion::Display::Width];
+  KDColor workingBuffer[Ion::Display::Width];
+  const uint8_t * data = static_cast<const uint8_t *>(bufferInfo.buf);
+  const int length = lastColumn - firstColumn;
+  for (mp_int_t j = firstRow; length > 0 && j < lastRow; j++) {
+    for (int k = 0; k < length; k++) {
+      const uint8_t * pixel = data + 2 * (static_cast<size_t>(j) * width + firstColumn + k);
+      line[k] = KDColor::RGB16(pixel[0] | (pixel[1] << 8));
+    }
+    context->fillRectWithPixels(KDRect(x + firstColumn, y + j, length, 1), line, workingBuffer);
+    if (micropython_port_vm_hook_loop()) {
+      break;
+    }
+  }
+  return mp_const_none;
+}
+
 mp_obj_t modkandinsky_wait_vblank() {
   micropython_port_interrupt_if_needed();
   Ion::Display::waitForVBlank();
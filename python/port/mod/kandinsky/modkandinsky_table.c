@@ -6,6 +6,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_3(modkandinsky_set_pixel_obj, modkandinsky_set_pi
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_draw_string_obj, 3, 6, modkandinsky_draw_string);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_draw_line_obj, 5, 5, modkandinsky_draw_line);
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_fill_rect_obj, 5, 5, modkandinsky_fill_rect);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(modkandinsky_set_pixels_obj, modkandinsky_set_pixels);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(modkandinsky_fill_rects_obj, modkandinsky_fill_rects);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modkandinsky_blit_obj, 5, 5, modkandinsky_blit);
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(modkandinsky_wait_vblank_obj, modkandinsky_wait_vblank);
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(modkandinsky_get_keys_obj, modkandinsky_get_keys);
 
@@ -17,6 +20,9 @@ STATIC const mp_rom_map_elem_t modkandinsky_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR_draw_string), (mp_obj_t)&modkandinsky_draw_string_obj },
   { MP_ROM_QSTR(MP_QSTR_draw_line), (mp_obj_t)&modkandinsky_draw_line_obj },
   { MP_ROM_QSTR(MP_QSTR_fill_rect), (mp_obj_t)&modkandinsky_fill_rect_obj },
+  { MP_ROM_QSTR(MP_QSTR_set_pixels), (mp_obj_t)&modkandinsky_set_pixels_obj },
+  { MP_ROM_QSTR(MP_QSTR_fill_rects), (mp_obj_t)&modkandinsky_fill_rects_obj },
+  { MP_ROM_QSTR(MP_QSTR_blit), (mp_obj_t)&modkandinsky_blit_obj },
   { MP_ROM_QSTR(MP_QSTR_large_font), mp_const_true },
   { MP_ROM_QSTR(MP_QSTR_small_font), mp_const_false },
   { MP_ROM_QSTR(MP_QSTR_wait_vblank), (mp_obj_t)&modkandinsky_wait_vblank_obj },
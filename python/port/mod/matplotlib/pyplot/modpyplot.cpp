@@ -1,7 +1,9 @@
 extern "C" {
 #include "modpyplot.h"
+#include <py/binary.h>
 }
 #include <assert.h>
+#include <algorithm>
 #include <escher/palette.h>
 #include "port.h"
 #include "plot_controller.h"
@@ -12,42 +14,84 @@ static int paletteIndex = 0;
 
 // Private helper
 
-// Method to populate items with a scalar or an array argument
-
-static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
-  size_t itemLength;
+/* A scalar argument, or an array argument which is either a list, a tuple or
+ * an object exposing the buffer protocol (array, bytearray, memoryview...).
+ * The items of buffers are read in place, without boxing them. */
+
+class Argument {
+public:
+  Argument(float scalar) : m_items(nullptr), m_buffer(nullptr), m_typecode(0), m_length(1), m_scalar(scalar) {}
+  Argument(mp_obj_t arg);
+  // Lists, tuples and buffers are read as sequences, other objects as scalars
+  static bool IsSequence(mp_obj_t arg);
+  size_t length() const { return m_length; }
+  float operator[](size_t i) const;
+private:
+  mp_obj_t * m_items;
+  void * m_buffer;
+  char m_typecode;
+  size_t m_length;
+  float m_scalar;
+};
+
+Argument::Argument(mp_obj_t arg) :
+  Argument(0.0f)
+{
+  mp_buffer_info_t bufferInfo;
   if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
-    mp_obj_get_array(arg, &itemLength, items);
+    mp_obj_get_array(arg, &m_length, &m_items);
+  } else if (!mp_obj_is_str(arg) && mp_get_buffer(arg, &bufferInfo, MP_BUFFER_READ)) {
+    m_buffer = bufferInfo.buf;
+    m_typecode = bufferInfo.typecode;
+    m_length = bufferInfo.len / mp_binary_get_size('@', m_typecode, nullptr);
   } else {
-    itemLength = 1;
-    *items = m_new(mp_obj_t, 1);
-    (*items)[0] = arg;
+    m_scalar = mp_obj_get_float(arg);
   }
-  return itemLength;
 }
 
-// Extract two scalar or array arguments and check for their strickly equal dimension
+bool Argument::IsSequence(mp_obj_t arg) {
+  mp_buffer_info_t bufferInfo;
+  return mp_obj_is_type(arg, &mp_type_tuple)
+    || mp_obj_is_type(arg, &mp_type_list)
+    || (!mp_obj_is_str(arg) && mp_get_buffer(arg, &bufferInfo, MP_BUFFER_READ));
+}
+
+float Argument::operator[](size_t i) const {
+  assert(i < m_length);
+  if (m_items != nullptr) {
+    return mp_obj_get_float(m_items[i]);
+  }
+  if (m_buffer == nullptr) {
+    return m_scalar;
+  }
+  if (m_typecode == 'f') {
+    return static_cast<const float *>(m_buffer)[i];
+  }
+  if (m_typecode == 'd') {
+    return static_cast<const double *>(m_buffer)[i];
+  }
+  return mp_obj_get_float(mp_binary_get_val_array(m_typecode, m_buffer, i));
+}
 
-static size_t extractArgumentsAndCheckEqualSize(mp_obj_t x, mp_obj_t y, mp_obj_t ** xItems, mp_obj_t ** yItems) {
-  size_t xLength = extractArgument(x, xItems);
-  size_t yLength = extractArgument(y, yItems);
-  if (xLength != yLength) {
+// Check that two arguments have strictly equal dimensions
+
+static size_t checkEqualSize(const Argument & x, const Argument & y) {
+  if (x.length() != y.length()) {
     mp_raise_ValueError("x and y must be the same size");
   }
-  return xLength;
+  return x.length();
 }
 
-/* Extract one scalar or array arguments and check that it is either:
+/* Check that an argument is either:
  * - of size 1
  * - of the required size
 */
 
-static size_t extractArgumentAndValidateSize(mp_obj_t arg, size_t requiredlength, mp_obj_t ** items) {
-  size_t itemLength = extractArgument(arg, items);
-  if (itemLength > 1 && requiredlength > 1 && itemLength != requiredlength) {
+static size_t validateSize(const Argument & arg, size_t requiredlength) {
+  if (arg.length() > 1 && requiredlength > 1 && arg.length() != requiredlength) {
     mp_raise_ValueError("shape mismatch");
   }
-  return itemLength;
+  return arg.length();
 }
 
 // Get color from keyword arguments if possible
@@ -108,7 +152,7 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args)
   elem = mp_map_lookup(kw_args, MP_OBJ_NEW_QSTR(MP_QSTR_head_width), MP_MAP_LOOKUP);
   /* Default head_width is 0.0f because we want a default width in pixel
    * coordinates which is handled by CurveView::drawArrow. */
-  mp_obj_t arrowWidth = (elem == nullptr) ? mp_obj_new_float(0.0f) : elem->value;
+  float arrowWidth = (elem == nullptr) ? 0.0f : mp_obj_get_float(elem->value);
 
   // Setting arrow color
   KDColor color;
@@ -118,7 +162,9 @@ mp_obj_t modpyplot_arrow(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args)
 
   // Adding the object to the plot
   assert(n_args >= 4);
-  sPlotStore->addSegment(args[0], args[1], mp_obj_new_float(mp_obj_get_float(args[0]) + mp_obj_get_float(args[2])), mp_obj_new_float(mp_obj_get_float(args[1]) + mp_obj_get_float(args[3])), color, arrowWidth);
+  float x = mp_obj_get_float(args[0]);
+  float y = mp_obj_get_float(args[1]);
+  sPlotStore->addSegment(x, y, x + mp_obj_get_float(args[2]), y + mp_obj_get_float(args[3]), color, arrowWidth);
   return mp_const_none;
 }
 
@@ -186,36 +232,23 @@ if (n_args > 4) {
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"bar() takes from 2 to 4 positional arguments but %d were given",n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t * xItems;
-  mp_obj_t * hItems;
-  mp_obj_t * wItems;
-  mp_obj_t * bItems;
-
   assert(n_args >= 2);
 
   // x arg
-  size_t xLength = extractArgument(args[0], &xItems);
+  Argument x(args[0]);
+  size_t xLength = x.length();
 
   // height arg
-  size_t hLength = extractArgumentAndValidateSize(args[1], xLength, &hItems);
+  Argument h(args[1]);
+  size_t hLength = validateSize(h, xLength);
 
   // width arg
-  size_t wLength = 1;
-  if (n_args >= 3) {
-    wLength = extractArgumentAndValidateSize(args[2], xLength, &wItems);
-  } else {
-    wItems = m_new(mp_obj_t, 1);
-    wItems[0] = mp_obj_new_float(0.8f);
-  }
+  Argument w(n_args >= 3 ? Argument(args[2]) : Argument(0.8f));
+  size_t wLength = validateSize(w, xLength);
 
   // bottom arg
-  size_t bLength = 1;
-  if (n_args >= 4) {
-    bLength = extractArgumentAndValidateSize(args[3], xLength, &bItems);
-  } else {
-    bItems = m_new(mp_obj_t, 1);
-    bItems[0] = mp_obj_new_float(0.0f);
-  }
+  Argument b(n_args >= 4 ? Argument(args[3]) : Argument(0.0f));
+  size_t bLength = validateSize(b, xLength);
 
   // Setting bar color
   // color keyword
@@ -225,19 +258,15 @@ if (n_args > 4) {
   colorFromKeywordArgument(elem, &color);
 
   for (size_t i=0; i<xLength; i++) {
-    mp_obj_t iH = hItems[hLength > 1 ? i : 0];
-    mp_obj_t iW = wItems[wLength > 1 ? i : 0];
-    mp_obj_t iB = bItems[bLength > 1 ? i : 0];
-    mp_obj_t iX = xItems[i];
-
-    float iWf = mp_obj_get_float(iW);
-    float iXf = mp_obj_get_float(iX);
-    mp_obj_t rectLeft = mp_obj_new_float(iXf - iWf/2.0f);
-    mp_obj_t rectRight = mp_obj_new_float(iXf + iWf/2.0f);
-    mp_obj_t rectBottom = iB;
-    mp_obj_t rectTop = mp_obj_new_float(mp_obj_get_float(iH) + mp_obj_get_float(iB));
-    if (mp_obj_get_float(iH) < 0.0) {
-      mp_obj_t temp = rectTop;
+    float iWf = w[wLength > 1 ? i : 0];
+    float iXf = x[i];
+    float iHf = h[hLength > 1 ? i : 0];
+    float rectLeft = iXf - iWf/2.0f;
+    float rectRight = iXf + iWf/2.0f;
+    float rectBottom = b[bLength > 1 ? i : 0];
+    float rectTop = iHf + rectBottom;
+    if (iHf < 0.0f) {
+      float temp = rectTop;
       rectTop = rectBottom;
       rectBottom = temp;
     }
@@ -272,38 +301,38 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args )
   }
   assert(sPlotStore != nullptr);
   sPlotStore->setShow(true);
-  // Sort data to easily get the minimal and maximal value and count bin sizes
-  mp_obj_t * xItems;
   assert(n_args >= 1);
-  size_t xLength = extractArgument(args[0], &xItems);
+  Argument x(args[0]);
+  size_t xLength = x.length();
   if (xLength == 0) {
     return mp_const_none;
   }
-  mp_obj_t xList = mp_obj_new_list(xLength, xItems);
-  mp_obj_list_sort(1, &xList, (mp_map_t*)&mp_const_empty_map);
-  mp_obj_list_get(xList, &xLength, &xItems);
-  assert(xLength > 0);
-  mp_float_t min = mp_obj_get_float(xItems[0]);
-  mp_float_t max = mp_obj_get_float(xItems[xLength - 1]);
-
-  // TODO: memory optimization
-  // Don't create a list of edges, compute the edge on the go if not present?
-  mp_obj_t * edgeItems;
+  float min = x[0];
+  float max = x[0];
+  for (size_t i = 1; i < xLength; i++) {
+    min = std::min(min, x[i]);
+    max = std::max(max, x[i]);
+  }
+
+  float * edges;
   size_t nBins;
   // bin arg
-  if (n_args >= 2 && (mp_obj_is_type(args[1], &mp_type_tuple) || mp_obj_is_type(args[1], &mp_type_list))) {
-    size_t nEdges;
-    mp_obj_get_array(args[1], &nEdges, &edgeItems);
-    nBins = nEdges -1;
+  if (n_args >= 2 && Argument::IsSequence(args[1])) {
+    Argument edgeArgument(args[1]);
+    nBins = edgeArgument.length() - 1;
+    edges = m_new(float, nBins + 1);
+    for (size_t i = 0; i < nBins + 1; i++) {
+      edges[i] = edgeArgument[i];
+    }
   } else {
     nBins = 10;
     if (n_args >= 2) {
       nBins = mp_obj_get_int(args[1]);
     }
 
-    mp_float_t binWidth = (max-min)/nBins;
+    mp_float_t binWidth = static_cast<mp_float_t>(max-min)/nBins;
     // Create a array of bins
-    edgeItems = m_new(mp_obj_t, nBins + 1);
+    edges = m_new(float, nBins + 1);
     // Handle empty range case
     if (max - min <= FLT_EPSILON) {
       binWidth = 1.0;
@@ -312,34 +341,32 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args )
 
     // Fill the bin edges list
     for (size_t i = 0; i < nBins+1; i++) {
-      edgeItems[i] = mp_obj_new_float(min+i*binWidth);
+      edges[i] = static_cast<float>(min+i*binWidth);
     }
   }
 
-  // Initialize bins list
-  mp_obj_t * binItems = m_new(mp_obj_t, nBins);
-  for (size_t i=0; i<nBins; i++) {
-    binItems[i] = MP_OBJ_NEW_SMALL_INT(0);
-  }
-
-  // Fill bins list by linearly scanning the x and incrementing the bin count
-  // Linearity is enabled thanks to sorting
-  size_t binIndex = 0;
-  size_t xIndex = 0;
-  while (binIndex < nBins) {
-    mp_float_t lowerBound = mp_obj_get_float(edgeItems[binIndex]);
-    // Skip xItem if below the lower bound
-    while (xIndex < xLength && mp_obj_get_float(xItems[xIndex]) < lowerBound) {
-      xIndex++;
+  /* Count the items of each bin: the bin i holds the items in
+   * [edges[i], edges[i+1]), and the last one also holds its upper bound. The
+   * bin of an item is found by dichotomy on the sorted edges. */
+  size_t * binCounts = m_new0(size_t, nBins);
+  for (size_t i = 0; i < xLength; i++) {
+    float xi = x[i];
+    if (nBins == 0 || xi < edges[0] || xi > edges[nBins]) {
+      continue;
+    }
+    size_t lower = 0;
+    size_t upper = nBins;
+    while (upper - lower > 1) {
+      size_t middle = (lower + upper) / 2;
+      if (xi < edges[middle]) {
+        upper = middle;
+      } else {
+        lower = middle;
+      }
     }
-    mp_float_t upperBound = mp_obj_get_float(edgeItems[binIndex+1]);
-    while (xIndex < xLength && (mp_obj_get_float(xItems[xIndex]) < upperBound || (binIndex == nBins - 1 && mp_obj_get_float(xItems[xIndex]) == upperBound))) {
-      assert(mp_obj_get_float(xItems[xIndex]) >= lowerBound);
-      // Increment the bin count
-      binItems[binIndex] = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(binItems[binIndex]) + 1);
-      xIndex++;
+    if (xi < edges[lower + 1] || lower == nBins - 1) {
+      binCounts[lower]++;
     }
-    binIndex++;
   }
 
   // Setting hist color
@@ -350,7 +377,7 @@ mp_obj_t modpyplot_hist(size_t n_args, const mp_obj_t *args, mp_map_t* kw_args )
   colorFromKeywordArgument(elem, &color);
 
   for (size_t i=0; i<nBins; i++) {
-    sPlotStore->addRect(edgeItems[i], edgeItems[i+1], binItems[i], mp_obj_new_float(0.0), color);
+    sPlotStore->addRect(edges[i], edges[i+1], binCounts[i], 0.0f, color);
   }
   return mp_const_none;
 }
@@ -366,9 +393,10 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"scatter() takes 2 positional arguments but %d were given",n_args));
   }
   sPlotStore->setShow(true);
-  mp_obj_t * xItems, * yItems;
   assert(n_args >= 2);
-  size_t length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+  Argument x(args[0]);
+  Argument y(args[1]);
+  size_t length = checkEqualSize(x, y);
 
   // Setting scatter color
   // color keyword
@@ -381,7 +409,7 @@ mp_obj_t modpyplot_scatter(size_t n_args, const mp_obj_t *args, mp_map_t* kw_arg
   colorFromKeywordArgument(elem, &color);
 
   for (size_t i=0; i<length; i++) {
-    sPlotStore->addDot(xItems[i], yItems[i], color);
+    sPlotStore->addDot(x[i], y[i], color);
   }
 
   return mp_const_none;
@@ -397,20 +425,11 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
   if (n_args > 3) {
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"plot() takes 3 positional arguments but %d were given",n_args));
   }
-  mp_obj_t * xItems, * yItems;
-  size_t length;
-  if (n_args == 1) {
-    length = extractArgument(args[0], &yItems);
-
-    // Create the default xItems: [0, 1, 2,...]
-    xItems = m_new(mp_obj_t, length);
-    for (size_t i = 0; i < length; i++) {
-      xItems[i] = mp_obj_new_float((float)i);
-    }
-  } else {
-    assert(n_args >= 2);
-    length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
-  }
+  // With a single argument, the default abscissas [0, 1, 2,...] are computed on the go
+  bool hasAbscissas = n_args >= 2;
+  Argument x(hasAbscissas ? Argument(args[0]) : Argument(0.0f));
+  Argument y(args[hasAbscissas ? 1 : 0]);
+  size_t length = hasAbscissas ? checkEqualSize(x, y) : y.length();
 
   // Setting plot color
   KDColor color;
@@ -426,8 +445,17 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
     color = MicroPython::Color::Parse(args[2]);
   }
 
-  for (int i=0; i<(int)length-1; i++) {
-    sPlotStore->addSegment(xItems[i], yItems[i], xItems[i+1], yItems[i+1], color);
+  if (length == 0) {
+    return mp_const_none;
+  }
+  float xStart = hasAbscissas ? x[0] : 0.0f;
+  float yStart = y[0];
+  for (size_t i = 1; i < length; i++) {
+    float xEnd = hasAbscissas ? x[i] : static_cast<float>(i);
+    float yEnd = y[i];
+    sPlotStore->addSegment(xStart, yStart, xEnd, yEnd, color);
+    xStart = xEnd;
+    yStart = yEnd;
   }
 
   return mp_const_none;
@@ -437,11 +465,11 @@ mp_obj_t modpyplot_text(mp_obj_t x, mp_obj_t y, mp_obj_t s) {
   assert(sPlotStore != nullptr);
   sPlotStore->setShow(true);
   // Input parameter validation
-  mp_obj_get_float(x);
-  mp_obj_get_float(y);
+  float xf = mp_obj_get_float(x);
+  float yf = mp_obj_get_float(y);
   mp_obj_str_get_str(s);
 
-  sPlotStore->addLabel(x, y, s);
+  sPlotStore->addLabel(xf, yf, s);
 
   return mp_const_none;
 }
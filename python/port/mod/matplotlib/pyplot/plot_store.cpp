@@ -10,134 +10,68 @@ PlotStore::PlotStore() : Shared::InteractiveCurveViewRange(),
 }
 
 void PlotStore::flush() {
-  m_dots = mp_obj_new_list(0, nullptr);
-  m_segments = mp_obj_new_list(0, nullptr);
-  m_rects = mp_obj_new_list(0, nullptr);
-  m_labels = mp_obj_new_list(0, nullptr);
+  m_dots.flush();
+  m_segments.flush();
+  m_rects.flush();
+  m_labels.flush();
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
 }
 
-// Iterators
+// PackedList
 
 template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::Begin(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  return it;
+void PlotStore::PackedList<T>::flush() {
+  /* The blocks are either freed with the Python heap or collected once the
+   * store does not point to them anymore. */
+  m_items = nullptr;
+  m_length = 0;
+  m_capacity = 0;
 }
 
 template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::End(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  if (it.m_numberOfTuples > 0) {
-    it.m_tupleIndex = it.m_numberOfTuples;
+void PlotStore::PackedList<T>::append(const T & item) {
+  if (m_length == m_capacity) {
+    // Grow by half to bound both the number of copies and the unused space
+    size_t newCapacity = m_capacity < 4 ? 8 : m_capacity + m_capacity / 2;
+    // m_renew raises a MemoryError if the heap is full
+    m_items = m_renew(T, m_items, m_capacity, newCapacity);
+    m_capacity = newCapacity;
   }
-  return it;
+  m_items[m_length++] = item;
 }
 
-template <class T>
-PlotStore::ListIterator<T> & PlotStore::ListIterator<T>::operator++() {
-  if (m_tupleIndex < m_numberOfTuples) {
-    m_tupleIndex++;
-  }
-  return *this;
-}
-
-template <class T>
-bool PlotStore::ListIterator<T>::operator!=(const PlotStore::ListIterator<T> & it) const {
-  return m_tupleIndex != it.m_tupleIndex;
-};
-
-template <class T>
-T PlotStore::ListIterator<T>::operator*() {
-  return T(m_tuples[m_tupleIndex]);
-};
-
+template class PlotStore::PackedList<PlotStore::Dot>;
+template class PlotStore::PackedList<PlotStore::Segment>;
+template class PlotStore::PackedList<PlotStore::Rect>;
+template class PlotStore::PackedList<PlotStore::Label>;
 
 // Dot
 
-template class PlotStore::ListIterator<PlotStore::Dot>;
-
-PlotStore::Dot::Dot(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[2]));
-}
-
-void PlotStore::addDot(mp_obj_t x, mp_obj_t y, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[3] = {x, y, color};
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_dots, tuple);
+void PlotStore::addDot(float x, float y, KDColor c) {
+  m_dots.append(Dot(x, y, c));
 }
 
 // Segment
 
-template class PlotStore::ListIterator<PlotStore::Segment>;
-
-PlotStore::Segment::Segment(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 6 , &elements);
-  m_xStart = mp_obj_get_float(elements[0]);
-  m_yStart = mp_obj_get_float(elements[1]);
-  m_xEnd = mp_obj_get_float(elements[2]);
-  m_yEnd = mp_obj_get_float(elements[3]);
-  m_arrowWidth = mp_obj_get_float(elements[4]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[5]));
-}
-
-void PlotStore::addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd, mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[6] = {xStart, yStart, xEnd, yEnd, arrowWidth, color};
-  mp_obj_t tuple = mp_obj_new_tuple(6, items);
-  mp_obj_list_append(m_segments, tuple);
+void PlotStore::addSegment(float xStart, float yStart, float xEnd, float yEnd, KDColor c, float arrowWidth) {
+  m_segments.append(Segment(xStart, yStart, xEnd, yEnd, arrowWidth, c));
 }
 
 // Rect
 
-template class PlotStore::ListIterator<PlotStore::Rect>;
-
-PlotStore::Rect::Rect(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 5, &elements);
-  m_left = mp_obj_get_float(elements[0]);
-  m_right = mp_obj_get_float(elements[1]);
-  m_top = mp_obj_get_float(elements[2]);
-  m_bottom = mp_obj_get_float(elements[3]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[4]));
-}
-
-void PlotStore::addRect(mp_obj_t left, mp_obj_t right, mp_obj_t top, mp_obj_t bottom, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[5] = {left, right, top, bottom, color};
-  mp_obj_t tuple = mp_obj_new_tuple(5, items);
-  mp_obj_list_append(m_rects, tuple);
+void PlotStore::addRect(float left, float right, float top, float bottom, KDColor c) {
+  m_rects.append(Rect(left, right, top, bottom, c));
 }
 
 // Label
 
-template class PlotStore::ListIterator<PlotStore::Label>;
-
-PlotStore::Label::Label(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_string = mp_obj_str_get_str(elements[2]);
-}
-
-void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
-  mp_obj_t items[3] = {x, y, string};
+void PlotStore::addLabel(float x, float y, mp_obj_t string) {
   if (!mp_obj_is_str(string)) {
     mp_raise_TypeError("argument should be a string");
   }
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_labels, tuple);
+  m_labels.append(Label(x, y, string));
 }
 
 // Axes
@@ -172,17 +106,17 @@ void PlotStore::initRange() {
     float xMax = -FLT_MAX;
     float yMin = FLT_MAX;
     float yMax = -FLT_MAX;
-    for (PlotStore::Dot dot : dots()) {
+    for (const PlotStore::Dot & dot : dots()) {
       updateRange(&xMin, &xMax, &yMin, &yMax, dot.x(), dot.y());
     }
-    for (PlotStore::Label label : labels()) {
+    for (const PlotStore::Label & label : labels()) {
       updateRange(&xMin, &xMax, &yMin, &yMax, label.x(), label.y());
     }
-    for (PlotStore::Segment segment : segments()) {
+    for (const PlotStore::Segment & segment : segments()) {
       updateRange(&xMin, &xMax, &yMin, &yMax, segment.xStart(), segment.yStart());
       updateRange(&xMin, &xMax, &yMin, &yMax, segment.xEnd(), segment.yEnd());
     }
-    for (PlotStore::Rect rectangle : rects()) {
+    for (const PlotStore::Rect & rectangle : rects()) {
       updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(), rectangle.top());
       updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.right(), rectangle.bottom());
     }
@@ -18,28 +18,28 @@ void PlotView::drawRect(KDContext * ctx, KDRect rect) const {
     drawLabelsAndGraduations(ctx, rect, Axis::Horizontal, true);
   }
 
-  for (PlotStore::Dot dot : m_store->dots()) {
+  for (const PlotStore::Dot & dot : m_store->dots()) {
     traceDot(ctx, rect, dot);
   }
 
-  for (PlotStore::Label label : m_store->labels()) {
+  for (const PlotStore::Label & label : m_store->labels()) {
     traceLabel(ctx, rect, label);
   }
 
-  for (PlotStore::Segment segment : m_store->segments()) {
+  for (const PlotStore::Segment & segment : m_store->segments()) {
     traceSegment(ctx, rect, segment);
   }
 
-  for (PlotStore::Rect rectangle : m_store->rects()) {
+  for (const PlotStore::Rect & rectangle : m_store->rects()) {
     traceRect(ctx, rect, rectangle);
   }
 }
 
-void PlotView::traceDot(KDContext * ctx, KDRect r, PlotStore::Dot dot) const {
+void PlotView::traceDot(KDContext * ctx, KDRect r, const PlotStore::Dot & dot) const {
   drawDot(ctx, r, dot.x(), dot.y(), dot.color());
 }
 
-void PlotView::traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segment) const {
+void PlotView::traceSegment(KDContext * ctx, KDRect r, const PlotStore::Segment & segment) const {
   drawSegment(
     ctx, r,
     segment.xStart(), segment.yStart(),
@@ -53,7 +53,7 @@ void PlotView::traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segmen
   }
 }
 
-void PlotView::traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const {
+void PlotView::traceRect(KDContext * ctx, KDRect r, const PlotStore::Rect & rect) const {
   KDCoordinate left = std::round(floatToPixel(Axis::Horizontal, rect.left()));
   KDCoordinate right = std::round(floatToPixel(Axis::Horizontal, rect.right()));
   KDCoordinate top = std::round(floatToPixel(Axis::Vertical, rect.top()));
@@ -67,7 +67,7 @@ void PlotView::traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const
   ctx->fillRect(pixelRect, rect.color());
 }
 
-void PlotView::traceLabel(KDContext * ctx, KDRect r, PlotStore::Label label) const {
+void PlotView::traceLabel(KDContext * ctx, KDRect r, const PlotStore::Label & label) const {
   drawLabel(ctx, r,
     label.x(), label.y(), label.string(),
     KDColorBlack,
@@ -99,6 +99,14 @@ mp_obj_t modturtle_speed(size_t n_args, const mp_obj_t *args) {
   return mp_const_none;
 }
 
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args) {
+  if (n_args == 0) {
+    return MP_OBJ_NEW_SMALL_INT(sTurtle.tracer());
+  }
+  sTurtle.setTracer(mp_obj_get_int(args[0]));
+  return mp_const_none;
+}
+
 mp_obj_t modturtle_position() {
   mp_obj_t mp_pos[2];
   mp_pos[0] = mp_obj_new_float(sTurtle.x());
@@ -36,6 +36,8 @@ void Turtle::reset() {
   m_penDown = true;
   m_visible = true;
   m_speed = k_defaultSpeed;
+  m_tracer = k_defaultTracer;
+  m_numberOfSkippedUpdates = 0;
   m_penSize = k_defaultPenSize;
   m_mileage = 0;
 
@@ -44,27 +46,9 @@ void Turtle::reset() {
 }
 
 bool Turtle::forward(mp_float_t length) {
-  /* cos and sin use radians, we thus need to multiply m_heading by PI/180 to
-   * compute the new turtle position. This induces rounding errors that are
-   * really visible when one expects a horizontal/vertical line and it is not.
-   * We thus make special cases for angles in degrees creating vertical /
-   * horizontal lines. */
-  if (m_heading == 0) {
-    return goTo(m_x + length, m_y);
-  }
-  if (m_heading == 180 || m_heading == -180) {
-    return goTo(m_x - length, m_y);
-  }
-  if (m_heading == 90 || m_heading == -270) {
-    return goTo(m_x, m_y + length);
-  }
-  if (m_heading == 270 || m_heading == -90) {
-    return goTo(m_x, m_y - length);
-  }
-  return goTo(
-    m_x + length * std::cos(m_heading * k_headingScale),
-    m_y + length * std::sin(m_heading * k_headingScale)
-  );
+  mp_float_t x, y;
+  forwardPosition(length, &x, &y);
+  return goTo(x, y);
 }
 
 void Turtle::left(mp_float_t angle) {
@@ -78,58 +62,27 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
     for (int i = 1; i < length; i++) {
       mp_float_t progress = i / length;
       // Move the turtle forward
-      if (forward(1)) {
+      mp_float_t x, y;
+      forwardPosition(1, &x, &y);
+      // Without animation, the turtle is only drawn at the end of the circle
+      if (m_speed == 0 ? move(x, y) : goTo(x, y)) {
         // Keyboard interruption. Return now to let MicroPython process it.
         return;
       }
       setHeadingPrivate(oldHeading+std::copysign(angle*progress, radius));
     }
-    forward(1);
+    mp_float_t x, y;
+    forwardPosition(1, &x, &y);
+    move(x, y);
     setHeading(oldHeading+angle);
   }
 }
 
 bool Turtle::goTo(mp_float_t x, mp_float_t y) {
-  mp_float_t oldx = m_x;
-  mp_float_t oldy = m_y;
-  mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
-  mp_float_t yLength = absF(std::floor(y) - std::floor(oldy));
-
-  enum PrincipalDirection {
-    None = 0,
-    X = 1,
-    Y = 2
-  };
-
-  PrincipalDirection principalDirection = xLength > yLength ?
-    PrincipalDirection::X :
-    (xLength == yLength ?
-     PrincipalDirection::None :
-     PrincipalDirection::Y);
-
-  mp_float_t length = principalDirection == PrincipalDirection::X ? xLength : yLength;
-
-  if (length > 1) {
-    // Tweening function
-    for (int i = 1; i < length; i++) {
-      mp_float_t progress = i / length;
-      erase();
-      /* We make sure that each pixel along the principal direction is drawn. If
-       * the computation of the position on the principal coordinate is done
-       * using a barycenter, roundings might skip some pixels, which results in
-       * a dotted line. */
-      mp_float_t currentX = xLength == 0 ? x : (principalDirection == PrincipalDirection::Y ? x * progress + oldx * (1 - progress) : oldx + (x > oldx ? i : -i));
-      mp_float_t currentY = yLength == 0 ? y : (principalDirection == PrincipalDirection::X ? y * progress + oldy * (1 - progress) : oldy + (y > oldy ? i : -i));
-      if (dot(currentX, currentY) || draw(false)) {
-        // Keyboard interruption. Return now to let MicroPython process it.
-        return true;
-      }
-    }
+  if (move(x, y)) {
+    return true;
   }
-
-  erase();
-  dot(x, y);
-  draw(true);
+  update();
   return false;
 }
 
@@ -137,7 +90,7 @@ void Turtle::setHeading(mp_float_t angle) {
   micropython_port_vm_hook_loop();
   setHeadingPrivate(angle);
   erase();
-  draw(true);
+  update();
 }
 
 void Turtle::setSpeed(mp_int_t speed) {
@@ -148,6 +101,14 @@ void Turtle::setSpeed(mp_int_t speed) {
   }
 }
 
+void Turtle::setTracer(mp_int_t tracer) {
+  m_tracer = tracer < 0 ? 0 : (tracer > k_maxTracer ? k_maxTracer : tracer);
+  m_numberOfSkippedUpdates = 0;
+  if (m_tracer > 0) {
+    draw(true);
+  }
+}
+
 void Turtle::setPenSize(KDCoordinate penSize) {
   if (m_penSize == penSize) {
     return;
@@ -216,6 +177,30 @@ void Turtle::setHeadingPrivate(mp_float_t angle) {
   }
 }
 
+void Turtle::forwardPosition(mp_float_t length, mp_float_t * x, mp_float_t * y) const {
+  /* cos and sin use radians, we thus need to multiply m_heading by PI/180 to
+   * compute the new turtle position. This induces rounding errors that are
+   * really visible when one expects a horizontal/vertical line and it is not.
+   * We thus make special cases for angles in degrees creating vertical /
+   * horizontal lines. */
+  if (m_heading == 0) {
+    *x = m_x + length;
+    *y = m_y;
+  } else if (m_heading == 180 || m_heading == -180) {
+    *x = m_x - length;
+    *y = m_y;
+  } else if (m_heading == 90 || m_heading == -270) {
+    *x = m_x;
+    *y = m_y + length;
+  } else if (m_heading == 270 || m_heading == -90) {
+    *x = m_x;
+    *y = m_y - length;
+  } else {
+    *x = m_x + length * std::cos(m_heading * k_headingScale);
+    *y = m_y + length * std::sin(m_heading * k_headingScale);
+  }
+}
+
 KDPoint Turtle::position(mp_float_t x, mp_float_t y) const {
   return KDPoint(std::floor(x + k_xOffset), std::floor(k_invertedYAxisCoefficient * y + k_yOffset));
 }
@@ -238,6 +223,7 @@ bool Turtle::hasDotMask() {
   }
 
   mp_float_t middle = m_penSize / 2;
+  m_dotMaskIsOpaque = true;
   for (int j = 0; j < m_penSize; j++) {
     for (int i = 0; i < m_penSize; i++) {
       mp_float_t distance = sqrt((j - middle)*(j - middle) + (i - middle)*(i - middle)) / (middle+1);
@@ -248,6 +234,7 @@ bool Turtle::hasDotMask() {
         value = 255;
       }
       m_dotMask[j*m_penSize+i] = value;
+      m_dotMaskIsOpaque = m_dotMaskIsOpaque && value == 0;
     }
   }
 
@@ -267,6 +254,79 @@ KDRect Turtle::iconRect() const {
   return KDRect(position().translatedBy(iconOffset), k_iconSize, k_iconSize);
 }
 
+bool Turtle::move(mp_float_t x, mp_float_t y) {
+  mp_float_t oldx = m_x;
+  mp_float_t oldy = m_y;
+  mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
+  mp_float_t yLength = absF(std::floor(y) - std::floor(oldy));
+
+  enum PrincipalDirection {
+    None = 0,
+    X = 1,
+    Y = 2
+  };
+
+  PrincipalDirection principalDirection = xLength > yLength ?
+    PrincipalDirection::X :
+    (xLength == yLength ?
+     PrincipalDirection::None :
+     PrincipalDirection::Y);
+
+  mp_float_t length = principalDirection == PrincipalDirection::X ? xLength : yLength;
+
+  /* Without animation, the turtle is erased once and the dots are gathered in
+   * spans. */
+  bool animated = m_speed > 0;
+  Span span;
+  if (!animated) {
+    MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+    erase();
+  }
+
+  if (length > 1) {
+    // Tweening function
+    for (int i = 1; i < length; i++) {
+      mp_float_t progress = i / length;
+      if (animated) {
+        erase();
+      }
+      /* We make sure that each pixel along the principal direction is drawn. If
+       * the computation of the position on the principal coordinate is done
+       * using a barycenter, roundings might skip some pixels, which results in
+       * a dotted line. */
+      mp_float_t currentX = xLength == 0 ? x : (principalDirection == PrincipalDirection::Y ? x * progress + oldx * (1 - progress) : oldx + (x > oldx ? i : -i));
+      mp_float_t currentY = yLength == 0 ? y : (principalDirection == PrincipalDirection::X ? y * progress + oldy * (1 - progress) : oldy + (y > oldy ? i : -i));
+      if (animated ? (dot(currentX, currentY) || draw(false)) : spanDot(currentX, currentY, &span)) {
+        // Keyboard interruption. Return now to let MicroPython process it.
+        drawSpan(&span);
+        return true;
+      }
+    }
+  }
+
+  erase();
+  if (animated) {
+    dot(x, y);
+  } else {
+    spanDot(x, y, &span);
+    drawSpan(&span);
+  }
+  return false;
+}
+
+void Turtle::update() {
+  /* Without animation, the turtle is drawn once every m_tracer commands, and
+   * the other updates only check for interruptions. */
+  bool drawTurtle = true;
+  if (m_speed == 0) {
+    drawTurtle = m_tracer > 0 && ++m_numberOfSkippedUpdates >= m_tracer;
+    if (drawTurtle) {
+      m_numberOfSkippedUpdates = 0;
+    }
+  }
+  draw(drawTurtle);
+}
+
 bool Turtle::draw(bool force) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
 
@@ -361,6 +421,29 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
     ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
   }
 
+  walkTo(x, y);
+  return micropython_port_vm_hook_loop();
+}
+
+bool Turtle::spanDot(mp_float_t x, mp_float_t y, Span * span) {
+  // Draw the dot if the pen is down
+  if (m_penDown && hasDotBuffers() && !isOutOfBounds()) {
+    KDPoint p = position(x, y);
+    if (!m_dotMaskIsOpaque) {
+      // Blended dots cannot be merged
+      KDContext * ctx = KDIonContext::sharedContext();
+      KDRect rect(p.translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)), KDSize(m_penSize, m_penSize));
+      ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
+    } else if (!span->add(p)) {
+      drawSpan(span);
+      span->reset(p);
+    }
+  }
+  walkTo(x, y);
+  return micropython_port_vm_hook_loop();
+}
+
+void Turtle::walkTo(mp_float_t x, mp_float_t y) {
   /* Increase the turtle's mileage. We need to make sure the mileage is not
    * overflowed, otherwise we might skip some msleeps in draw. */
   uint16_t additionalMileage = sqrt((x - m_x) * (x - m_x) + (y - m_y) * (y - m_y)) * 1000;
@@ -370,8 +453,50 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
 
   m_x = x;
   m_y = y;
+}
 
-  return micropython_port_vm_hook_loop();
+void Turtle::drawSpan(Span * span) {
+  if (span->isEmpty()) {
+    return;
+  }
+  KDIonContext::sharedContext()->fillRect(span->rect(m_penSize), m_color);
+  span->clear();
+}
+
+bool Turtle::Span::add(KDPoint point) {
+  if (m_length == 0) {
+    reset(point);
+    return true;
+  }
+  if (m_length == 1 && (point.x() != m_origin.x() || point.y() != m_origin.y())) {
+    // The second point decides the direction of the span
+    m_horizontal = point.y() == m_origin.y();
+  }
+  KDCoordinate along = m_horizontal ? point.x() - m_origin.x() : point.y() - m_origin.y();
+  KDCoordinate across = m_horizontal ? point.y() - m_origin.y() : point.x() - m_origin.x();
+  if (across != 0 || along < -1 || along > m_length) {
+    return false;
+  }
+  if (along == -1) {
+    m_origin = point;
+    m_length++;
+  } else if (along == m_length) {
+    m_length++;
+  }
+  return true;
+}
+
+KDRect Turtle::Span::rect(KDCoordinate penSize) const {
+  return KDRect(
+    m_origin.translatedBy(KDPoint(-penSize/2, -penSize/2)),
+    m_horizontal ? m_length + penSize - 1 : penSize,
+    m_horizontal ? penSize : m_length + penSize - 1);
+}
+
+void Turtle::Span::reset(KDPoint point) {
+  m_origin = point;
+  m_length = 1;
+  m_horizontal = true;
 }
 
 void Turtle::drawPaw(PawType type, PawPosition pos) {
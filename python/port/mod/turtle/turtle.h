@@ -33,7 +33,10 @@ public:
     m_colorMode(MicroPython::Color::Mode::MaxIntensity255),
     m_penDown(true),
     m_visible(true),
+    m_dotMaskIsOpaque(false),
     m_speed(k_defaultSpeed),
+    m_tracer(k_defaultTracer),
+    m_numberOfSkippedUpdates(0),
     m_penSize(k_defaultPenSize),
     m_mileage(0),
     m_drawn(false)
@@ -55,6 +58,13 @@ public:
   uint8_t speed() const { return m_speed; }
   void setSpeed(mp_int_t speed);
 
+  /* With the speed 0, the turtle is not animated: paths are drawn by spans and
+   * the turtle is only drawn once per command. tracer(n) further skips the
+   * drawing of the turtle, which is then only drawn after every n-th command,
+   * and never if n is 0. */
+  uint8_t tracer() const { return m_tracer; }
+  void setTracer(mp_int_t tracer);
+
   mp_float_t x() const { return m_x; }
   mp_float_t y() const { return m_y; }
 
@@ -98,6 +108,8 @@ private:
   static constexpr KDCoordinate k_yOffset = (Ion::Display::Height - Metric::TitleBarHeight) / 2;
   static constexpr uint8_t k_defaultSpeed = 8;
   static constexpr uint8_t k_maxSpeed = 10;
+  static constexpr uint8_t k_defaultTracer = 1;
+  static constexpr uint8_t k_maxTracer = 255;
   static constexpr KDColor k_defaultColor = KDColorBlack;
   static constexpr uint8_t k_defaultPenSize = 1;
   static constexpr const KDFont * k_font = KDFont::LargeFont;
@@ -118,7 +130,25 @@ private:
     Forward = 2
   };
 
+  /* A span gathers adjacent dots of the same row or column, to draw them all
+   * at once when the dot mask is opaque. */
+  class Span {
+  public:
+    Span() : m_origin(0, 0), m_length(0), m_horizontal(true) {}
+    bool isEmpty() const { return m_length == 0; }
+    // Return false if point is not adjacent to the span
+    bool add(KDPoint point);
+    KDRect rect(KDCoordinate penSize) const;
+    void reset(KDPoint point);
+    void clear() { m_length = 0; }
+  private:
+    KDPoint m_origin; // Top-left point of the span
+    KDCoordinate m_length;
+    bool m_horizontal;
+  };
+
   void setHeadingPrivate(mp_float_t angle);
+  void forwardPosition(mp_float_t length, mp_float_t * x, mp_float_t * y) const;
   KDPoint position(mp_float_t x, mp_float_t y) const;
   KDPoint position() const { return position(m_x, m_y); }
 
@@ -129,8 +159,14 @@ private:
   KDRect iconRect() const;
 
   // Interruptible methods that return true if they have been interrupted
+  bool move(mp_float_t x, mp_float_t y);
   bool draw(bool force);
   bool dot(mp_float_t x, mp_float_t y);
+  bool spanDot(mp_float_t x, mp_float_t y, Span * span);
+
+  void update();
+  void walkTo(mp_float_t x, mp_float_t y);
+  void drawSpan(Span * span);
 
   void drawPaw(PawType type, PawPosition position);
   void erase();
@@ -155,8 +191,11 @@ private:
   MicroPython::Color::Mode m_colorMode;
   bool m_penDown;
   bool m_visible;
+  bool m_dotMaskIsOpaque;
 
   uint8_t m_speed; // Speed is between 0 and 10
+  uint8_t m_tracer;
+  uint8_t m_numberOfSkippedUpdates;
   KDCoordinate m_penSize;
 
   /* We sleep every time the turtle walks a mileageLimit amount, to allow user
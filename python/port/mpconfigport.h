@@ -55,7 +55,10 @@
 #define MICROPY_PY_ASYNC_AWAIT (0)
 
 // Whether to support bytearray object
-#define MICROPY_PY_BUILTINS_BYTEARRAY (0)
+#define MICROPY_PY_BUILTINS_BYTEARRAY (1)
+
+// Whether to support memoryview object
+#define MICROPY_PY_BUILTINS_MEMORYVIEW (1)
 
 // Whether to support frozenset object
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
@@ -72,7 +75,7 @@
 // Whether to provide "array" module. Note that large chunk of the
 // underlying code is shared with "bytearray" builtin type, so to
 // get real savings, it should be disabled too.
-#define MICROPY_PY_ARRAY (0)
+#define MICROPY_PY_ARRAY (1)
 
 // Whether to support attrtuple type (MicroPython extension)
 // It provides space-efficient tuples with attribute access
@@ -94,7 +97,7 @@
 #define MICROPY_PY_IO (0)
 
 // Whether to provide "struct" module
-#define MICROPY_PY_STRUCT (0)
+#define MICROPY_PY_STRUCT (1)
 
 // Whether to provide "sys" module
 #define MICROPY_PY_SYS (0)
@@ -111,9 +114,27 @@
 // Function to seed URANDOM with on init
 #define MICROPY_PY_URANDOM_SEED_INIT_FUNC micropython_port_random()
 
+// Emit machine code for the @micropython.native and @micropython.viper
+// decorators, on the platforms which can run code from RAM. The device is left
+// out until the MPU attributes of the Python heap are checked on hardware.
+#if defined(__x86_64__) && defined(__linux__)
+#define MICROPY_EMIT_X64 (1)
+#endif
+
+#if defined(MICROPY_EMIT_X64) || defined(MICROPY_EMIT_THUMB)
+// Native loops must remain interruptible from the keyboard
+#define MICROPY_EMIT_NATIVE_VM_HOOK (1)
+// Native code is allocated on the heap and made executable, see port.cpp
+#define MP_PLAT_COMMIT_EXEC(buf, len, opt_ri) micropython_port_commit_exec(buf, len)
+#endif
+
 // Make a pointer to RAM callable (eg set lower bit for Thumb code)
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
+#if defined(MICROPY_EMIT_THUMB)
+#define MICROPY_MAKE_POINTER_CALLABLE(p) ((void *)((mp_uint_t)(p) | 1))
+#else
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
+#endif
 
 #define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
 
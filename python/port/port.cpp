@@ -1,4 +1,5 @@
 #include "port.h"
+#include "helpers.h"
 
 #include <ion.h>
 
@@ -79,6 +80,7 @@ bool MicroPython::ExecutionEnvironment::runCode(const char * str) {
   /* Set the user interruption now, as it is needed for the normal execution and
    * for the exception handling (because of print). */
   mp_hal_set_interrupt_char((int)Ion::Keyboard::Key::Back);
+  micropython_port_vm_hook_reset();
 
   bool runSucceeded = true;
   nlr_buf_t nlr;
@@ -228,30 +230,41 @@ KDColor MicroPython::Color::Parse(mp_obj_t input, Mode mode){
     size_t l;
     const char * color = mp_obj_str_get_data(input, &l);
     constexpr NamedColor pairs[] = {
-      NamedColor("blue", KDColorBlue),
-      NamedColor("b", KDColorBlue),
-      NamedColor("red", KDColorRed),
-      NamedColor("r", KDColorRed),
-      NamedColor("green", Palette::Green),
-      NamedColor("g", Palette::Green),
-      NamedColor("yellow", KDColorYellow),
-      NamedColor("y", KDColorYellow),
-      NamedColor("brown", Palette::Brown),
-      NamedColor("black", KDColorBlack),
-      NamedColor("k", KDColorBlack),
-      NamedColor("white", KDColorWhite),
-      NamedColor("w", KDColorWhite),
-      NamedColor("pink", Palette::Pink),
-      NamedColor("orange", Palette::Orange),
-      NamedColor("purple", Palette::Purple),
-      NamedColor("gray", Palette::GrayDark),
-      NamedColor("grey", Palette::GrayDark),
-      NamedColor("cyan", Palette::Cyan),
-      NamedColor("magenta", Palette::Magenta)
+      NamedColor(MP_QSTR_blue, KDColorBlue),
+      NamedColor(MP_QSTR_b, KDColorBlue),
+      NamedColor(MP_QSTR_red, KDColorRed),
+      NamedColor(MP_QSTR_r, KDColorRed),
+      NamedColor(MP_QSTR_green, Palette::Green),
+      NamedColor(MP_QSTR_g, Palette::Green),
+      NamedColor(MP_QSTR_yellow, KDColorYellow),
+      NamedColor(MP_QSTR_y, KDColorYellow),
+      NamedColor(MP_QSTR_brown, Palette::Brown),
+      NamedColor(MP_QSTR_black, KDColorBlack),
+      NamedColor(MP_QSTR_k, KDColorBlack),
+      NamedColor(MP_QSTR_white, KDColorWhite),
+      NamedColor(MP_QSTR_w, KDColorWhite),
+      NamedColor(MP_QSTR_pink, Palette::Pink),
+      NamedColor(MP_QSTR_orange, Palette::Orange),
+      NamedColor(MP_QSTR_purple, Palette::Purple),
+      NamedColor(MP_QSTR_gray, Palette::GrayDark),
+      NamedColor(MP_QSTR_grey, Palette::GrayDark),
+      NamedColor(MP_QSTR_cyan, Palette::Cyan),
+      NamedColor(MP_QSTR_magenta, Palette::Magenta)
     };
-    for (NamedColor p : pairs) {
-      if (strcmp(p.name(), color) == 0) {
-        return p.color();
+    if (mp_obj_is_qstr(input)) {
+      /* String literals are interned: if the input is a color name, it is the
+       * qstr of this name. */
+      qstr name = MP_OBJ_QSTR_VALUE(input);
+      for (NamedColor p : pairs) {
+        if (p.name() == name) {
+          return p.color();
+        }
+      }
+    } else {
+      for (NamedColor p : pairs) {
+        if (strcmp(qstr_str(p.name()), color) == 0) {
+          return p.color();
+        }
       }
     }
 
@@ -335,6 +348,22 @@ void gc_collect_regs_and_stack(void) {
   MicroPython::collectRootsAtAddress((char *)scanStart, stackLengthInByte);
 }
 
+#if MICROPY_EMIT_NATIVE
+
+/* The code emitted for @micropython.native and @micropython.viper functions is
+ * allocated on the Python heap like any other object, so that no memory is set
+ * aside until a native function is compiled. It is made executable once
+ * written. */
+void * micropython_port_commit_exec(void * ptr, size_t size) {
+  if (!Ion::makeExecutable(ptr, size)) {
+    m_malloc_fail(size);
+  }
+  Ion::synchronizeInstructionCache(ptr, size);
+  return ptr;
+}
+
+#endif
+
 void gc_collect(void) {
   gc_collect_start();
   modturtle_gc_collect();
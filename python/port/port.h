@@ -52,14 +52,14 @@ public:
 private:
   class NamedColor {
   public:
-    constexpr NamedColor(const char * name, KDColor color) :
+    constexpr NamedColor(qstr name, KDColor color) :
       m_name(name),
       m_color(color)
     {}
-    const char * name() const { return m_name; }
+    qstr name() const { return m_name; }
     KDColor color() const { return m_color; }
   private:
-    const char * m_name;
+    qstr m_name;
     KDColor m_color;
   };
 };
@@ -1968,11 +1968,27 @@ STATIC void emit_native_rot_three(emit_t *emit) {
     emit_post_push_reg_reg_reg(emit, vtype0, REG_TEMP0, vtype2, REG_TEMP2, vtype1, REG_TEMP1);
 }
 
+#if MICROPY_EMIT_NATIVE_VM_HOOK
+// Index of the vm_hook entry, which comes after all the mp_fun_kind_t ones
+#define MP_F_VM_HOOK ((mp_fun_kind_t)(offsetof(mp_fun_table_t, vm_hook) / sizeof(void *)))
+
+STATIC void emit_native_vm_hook_if_backward(emit_t *emit, mp_uint_t label) {
+    // Labels not assigned yet in the compute pass have an offset of (size_t)-1,
+    // and forward labels keep their computed offset in the emit pass
+    if (emit->as->base.label_offsets[label] <= emit->as->base.code_offset) {
+        emit_call(emit, MP_F_VM_HOOK);
+    }
+}
+#endif
+
 STATIC void emit_native_jump(emit_t *emit, mp_uint_t label) {
     DEBUG_printf("jump(label=" UINT_FMT ")\n", label);
     emit_native_pre(emit);
     // need to commit stack because we are jumping elsewhere
     need_stack_settled(emit);
+    #if MICROPY_EMIT_NATIVE_VM_HOOK
+    emit_native_vm_hook_if_backward(emit, label);
+    #endif
     ASM_JUMP(emit->as, label);
     emit_post(emit);
 }
@@ -2016,6 +2032,10 @@ STATIC void emit_native_jump_helper(emit_t *emit, bool cond, mp_uint_t label, bo
 
 STATIC void emit_native_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
     DEBUG_printf("pop_jump_if(cond=%u, label=" UINT_FMT ")\n", cond, label);
+    #if MICROPY_EMIT_NATIVE_VM_HOOK
+    // the hook call spills the condition to the stack before it is popped
+    emit_native_vm_hook_if_backward(emit, label);
+    #endif
     emit_native_jump_helper(emit, cond, label, true);
 }
 
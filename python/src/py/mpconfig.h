@@ -278,6 +278,12 @@
 #define MICROPY_PERSISTENT_CODE (MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// Whether native code runs MICROPY_VM_HOOK_LOOP and checks for a pending
+// exception on backward jumps, so that native loops can be interrupted
+#ifndef MICROPY_EMIT_NATIVE_VM_HOOK
+#define MICROPY_EMIT_NATIVE_VM_HOOK (0)
+#endif
+
 // Whether to emit x64 native code
 #ifndef MICROPY_EMIT_X64
 #define MICROPY_EMIT_X64 (0)
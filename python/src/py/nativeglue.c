@@ -211,6 +211,26 @@ STATIC bool mp_native_yield_from(mp_obj_t gen, mp_obj_t send_value, mp_obj_t *re
     return false;
 }
 
+#if MICROPY_EMIT_NATIVE_VM_HOOK
+
+// Called by native code on backward jumps, like the VM's pending exception check
+STATIC void mp_native_vm_hook(void) {
+    #ifdef MICROPY_VM_HOOK_LOOP
+    MICROPY_VM_HOOK_LOOP
+    #endif
+    #if MICROPY_ENABLE_SCHEDULER
+    mp_handle_pending();
+    #else
+    mp_obj_t obj = MP_STATE_VM(mp_pending_exception);
+    if (obj != MP_OBJ_NULL) {
+        MP_STATE_VM(mp_pending_exception) = MP_OBJ_NULL;
+        nlr_raise(obj);
+    }
+    #endif
+}
+
+#endif
+
 #if MICROPY_PY_BUILTINS_FLOAT
 
 STATIC mp_obj_t mp_obj_new_float_from_f(float f) {
@@ -323,7 +343,11 @@ const mp_fun_table_t mp_fun_table = {
     mp_obj_get_type,
     mp_obj_new_str,
     mp_obj_new_bytes,
+    #if MICROPY_PY_BUILTINS_BYTEARRAY
     mp_obj_new_bytearray_by_ref,
+    #else
+    NULL,
+    #endif
     mp_obj_new_float_from_f,
     mp_obj_new_float_from_d,
     mp_obj_get_float_to_f,
@@ -344,6 +368,9 @@ const mp_fun_table_t mp_fun_table = {
     &mp_stream_readinto_obj,
     &mp_stream_unbuffered_readline_obj,
     &mp_stream_write_obj,
+    #if MICROPY_EMIT_NATIVE_VM_HOOK
+    mp_native_vm_hook,
+    #endif
 };
 
 #endif // MICROPY_EMIT_NATIVE
@@ -170,6 +170,11 @@ typedef struct _mp_fun_table_t {
     const mp_obj_fun_builtin_var_t *stream_readinto_obj;
     const mp_obj_fun_builtin_var_t *stream_unbuffered_readline_obj;
     const mp_obj_fun_builtin_var_t *stream_write_obj;
+    #if MICROPY_EMIT_NATIVE_VM_HOOK
+    // Additional entry for the checks on backward jumps, kept last so that the
+    // indices of the dynamic runtime entries are unchanged
+    void (*vm_hook)(void);
+    #endif
 } mp_fun_table_t;
 
 extern const mp_fun_table_t mp_fun_table;
@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include "execution_environment.h"
+#include "../port/helpers.h"
 
 QUIZ_CASE(python_basics) {
   TestExecutionEnvironment env = init_environement();
@@ -7,6 +8,40 @@ QUIZ_CASE(python_basics) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_vm_hook_polling) {
+  TestExecutionEnvironment env = init_environement();
+  micropython_port_vm_hook_statistics_t before = micropython_port_vm_hook_statistics();
+  assert_command_execution_succeeds(env, "for i in range(20000):\n  pass");
+  micropython_port_vm_hook_statistics_t after = micropython_port_vm_hook_statistics();
+  uint32_t numberOfCalls = after.numberOfCalls - before.numberOfCalls;
+  uint32_t numberOfTimerChecks = after.numberOfTimerChecks - before.numberOfTimerChecks;
+  quiz_assert(numberOfCalls >= 20000);
+  // The timer is not read at each backward branch
+  quiz_assert(4 * numberOfTimerChecks < numberOfCalls);
+  // But it is still read at least every 512 calls
+  quiz_assert(numberOfTimerChecks >= numberOfCalls / 512);
+  quiz_assert(after.numberOfPollings - before.numberOfPollings <= numberOfTimerChecks);
+
+  // The next execution starts with the timer read at the first call again
+  before = micropython_port_vm_hook_statistics();
+  assert_command_execution_succeeds(env, "for i in range(3):\n  pass");
+  after = micropython_port_vm_hook_statistics();
+  quiz_assert(after.numberOfTimerChecks > before.numberOfTimerChecks);
+  deinit_environment();
+}
+
+QUIZ_CASE(python_typed_arrays) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from array import array");
+  assert_command_execution_succeeds(env, "a=array('d',[1.5,2.5])");
+  assert_command_execution_succeeds(env, "a.append(3);sum(a)", "7.0\n");
+  assert_command_execution_succeeds(env, "b=bytearray(b'ab');b[0]=99;b", "bytearray(b'cb')\n");
+  assert_command_execution_succeeds(env, "memoryview(a)[1]", "2.5\n");
+  assert_command_execution_succeeds(env, "import struct");
+  assert_command_execution_succeeds(env, "struct.unpack('<hf',struct.pack('<hf',-2,0.5))", "(-2, 0.5)\n");
+  deinit_environment();
+}
+
 QUIZ_CASE(python_template) {
   assert_script_execution_succeeds(Code::ScriptTemplate::Squares()->content());
   assert_script_execution_succeeds(Code::ScriptTemplate::Mandelbrot()->content());
@@ -23,3 +23,24 @@ QUIZ_CASE(python_ion_keydown) {
   assert_command_execution_succeeds(env, "keydown(KEY_LEFT)", "False\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_ion_file_buffers) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from array import array");
+  assert_command_execution_succeeds(env, "f=open('buffers.dat','wb')");
+  assert_command_execution_succeeds(env, "f.write(array('h',[1,-1]))", "4\n");
+  assert_command_execution_succeeds(env, "f.write(bytearray(b'xyz'))", "3\n");
+  assert_command_execution_fails(env, "f.write('text')");
+  assert_command_execution_succeeds(env, "f.close()");
+  assert_command_execution_succeeds(env, "f=open('buffers.dat','rb')");
+  assert_command_execution_succeeds(env, "a=array('h',[0,0])");
+  assert_command_execution_succeeds(env, "f.readinto(a)", "4\n");
+  assert_command_execution_succeeds(env, "a", "array('h', [1, -1])\n");
+  assert_command_execution_succeeds(env, "b=bytearray(8)");
+  assert_command_execution_succeeds(env, "f.readinto(b)", "3\n");
+  assert_command_execution_succeeds(env, "f.readinto(b)", "0\n");
+  assert_command_execution_succeeds(env, "f.close()");
+  assert_command_execution_succeeds(env, "import os");
+  assert_command_execution_succeeds(env, "os.remove('buffers.dat')");
+  deinit_environment();
+}
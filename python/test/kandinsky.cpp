@@ -1,4 +1,8 @@
 #include <quiz.h>
+#include <stdint.h>
+#if !PLATFORM_DEVICE
+#include <ion/src/simulator/shared/framebuffer.h>
+#endif
 #include "execution_environment.h"
 
 QUIZ_CASE(python_kandinsky_import) {
@@ -26,3 +30,80 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_colors) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "color('red')==color(255,0,0)", "True\n");
+  // Strings built at runtime are not interned
+  assert_command_execution_succeeds(env, "color('re'+'d')==color('red')", "True\n");
+  assert_command_execution_succeeds(env, "color('k')==color('black')", "True\n");
+  assert_command_execution_succeeds(env, "color('#0000ff')==color('blue')", "True\n");
+  assert_command_execution_fails(env, "color('redd')");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_kandinsky_batch_primitives) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "set_pixels([(1,2),(3,4)],'red')");
+  assert_command_execution_fails(env, "set_pixels([(1,2),(3,)],'red')");
+  assert_command_execution_succeeds(env, "fill_rects([(0,0,5,5),(10,10,-5,-5)],'blue')");
+  assert_command_execution_succeeds(env, "blit(20,20,2,1,b'\\x00\\xf8\\x1f\\x00')");
+  assert_command_execution_fails(env, "blit(0,0,2,2,b'\\x00\\xf8')");
+  assert_command_execution_fails(env, "blit(0,0,1,1,[0,0])");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_kandinsky_buffers) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "from array import array");
+  assert_command_execution_succeeds(env, "set_pixels(array('h',[1,2,3,4]),'red')");
+  assert_command_execution_fails(env, "set_pixels(array('h',[1,2,3]),'red')");
+  assert_command_execution_fails(env, "set_pixels(array('f',[1,2]),'red')");
+  assert_command_execution_succeeds(env, "blit(0,0,2,2,bytearray(8))");
+  assert_command_execution_succeeds(env, "blit(0,0,2,1,array('H',[0xf800,0x001f]))");
+  assert_command_execution_succeeds(env, "blit(0,0,2,1,memoryview(bytearray(8))[4:])");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_kandinsky_blit) {
+  /* Dimensions whose product overflows, on 32 or 64 bits, or does not match
+   * the buffer size are rejected. */
+  assert_script_execution_succeeds(
+    "from kandinsky import *\n"
+    "for size in ((65536,65536,b''),(65536,32768,bytes(4)),(1000,1000,bytes(2))):\n"
+    "  try:\n"
+    "    blit(0,0,*size)\n"
+    "    print('drawn')\n"
+    "  except ValueError:\n"
+    "    print('ValueError')\n",
+    "ValueError\nValueError\nValueError\n");
+#if UINTPTR_MAX > 0xFFFFFFFF
+  assert_script_execution_succeeds(
+    "from kandinsky import *\n"
+    "try:\n"
+    "  blit(0,0,1<<32,1<<31,b'')\n"
+    "except ValueError:\n"
+    "  print('ValueError')\n",
+    "ValueError\n");
+#endif
+#if !PLATFORM_DEVICE
+  // Headless simulators only keep the pixels when the framebuffer is active
+  Ion::Simulator::Framebuffer::setActive(true);
+#endif
+  // Pixels are read row by row, and clipped to the screen
+  assert_script_execution_succeeds(
+    "from kandinsky import *\n"
+    "blit(20,20,2,2,bytes([0,0xf8,0x1f,0,0xe0,0x07,0xff,0xff]))\n"
+    "print(get_pixel(20,20),get_pixel(21,20),get_pixel(20,21),get_pixel(21,21))\n"
+    "blit(-1,-1,2,2,bytes([0,0xf8,0,0xf8,0,0xf8,0x1f,0]))\n"
+    "print(get_pixel(0,0))\n"
+    "blit(319,239,2,2,bytes([0xe0,0x07,0,0xf8,0,0xf8,0,0xf8]))\n"
+    "print(get_pixel(319,239))\n",
+    "(248, 0, 0) (0, 0, 248) (0, 252, 0) (248, 252, 248)\n(0, 0, 248)\n(0, 252, 0)\n");
+#if !PLATFORM_DEVICE
+  Ion::Simulator::Framebuffer::setActive(false);
+#endif
+}
@@ -86,6 +86,7 @@ QUIZ_CASE(python_matplotlib_pyplot_hist) {
   assert_command_execution_succeeds(env, "hist([2,3,4,5,6],[0,2,3])");
   assert_command_execution_succeeds(env, "hist([2,3,4,5,6],[0,2,3, 4,5,6,7])");
   assert_command_execution_succeeds(env, "hist([2,3,4,5,6],[0,2,3, 4,5,6,7], color=(0,255,0))");
+  assert_command_execution_fails(env, "hist([2,3,4,5,6],5.0)");
   assert_command_execution_succeeds(env, "show()");
   deinit_environment();
 }
@@ -102,6 +103,42 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_matplotlib_pyplot_large_plots) {
+  // Primitives are packed and do not exhaust the heap
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "x=[i/10 for i in range(500)]");
+  assert_command_execution_succeeds(env, "y=[t*t for t in x]");
+  assert_command_execution_succeeds(env, "plot(x,y)");
+  assert_command_execution_succeeds(env, "scatter(x,y)");
+  assert_command_execution_succeeds(env, "show()");
+  deinit_environment();
+  env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "plot([i%7 for i in range(2000)])");
+  assert_command_execution_succeeds(env, "bar(list(range(500)),1)");
+  assert_command_execution_succeeds(env, "show()");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_matplotlib_pyplot_buffers) {
+  // Typed arrays are read in place, without boxing their items
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "from array import array");
+  assert_command_execution_succeeds(env, "x=array('f',range(1000))");
+  assert_command_execution_succeeds(env, "y=array('d',(t*t for t in x))");
+  assert_command_execution_succeeds(env, "plot(x,y)");
+  assert_command_execution_succeeds(env, "plot(array('b',[1,-2,3]))");
+  assert_command_execution_succeeds(env, "scatter(x[:100],bytearray(100))");
+  assert_command_execution_succeeds(env, "bar(array('i',[1,2,3]),array('f',[3,1,2]))");
+  assert_command_execution_succeeds(env, "hist(y,array('f',[0,100,1000]))");
+  assert_command_execution_succeeds(env, "hist(memoryview(x))");
+  assert_command_execution_fails(env, "plot(x,array('f',[1,2]))");
+  assert_command_execution_succeeds(env, "show()");
+  deinit_environment();
+}
+
 QUIZ_CASE(python_matplotlib_pyplot_scatter) {
   TestExecutionEnvironment env = init_environement();
   assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
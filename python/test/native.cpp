@@ -0,0 +1,107 @@
+#include <quiz.h>
+#include "execution_environment.h"
+#include "../port/helpers.h"
+
+#if MICROPY_EMIT_NATIVE
+
+QUIZ_CASE(python_native) {
+  assert_script_execution_succeeds(
+      "@micropython.native\n"
+      "def sum_of_squares(n):\n"
+      "  s = 0\n"
+      "  for i in range(n):\n"
+      "    s += i * i\n"
+      "  return s\n"
+      "print(sum_of_squares(1000))\n"
+      "print(sum_of_squares(100000))\n",
+      "332833500\n333328333350000\n");
+  assert_script_execution_fails(
+      "@micropython.native\n"
+      "def inverse(x):\n"
+      "  return 1 / x\n"
+      "inverse(0)\n");
+}
+
+QUIZ_CASE(python_viper) {
+  assert_script_execution_succeeds(
+      "@micropython.viper\n"
+      "def collatz_length(n: int) -> int:\n"
+      "  length = 0\n"
+      "  while n != 1:\n"
+      "    if n & 1:\n"
+      "      n = 3 * n + 1\n"
+      "    else:\n"
+      "      n = n >> 1\n"
+      "    length += 1\n"
+      "  return length\n"
+      "print(collatz_length(27))\n",
+      "111\n");
+  assert_script_execution_fails(
+      "@micropython.viper\n"
+      "def f(x: int) -> int:\n"
+      "  return x + 'a'\n");
+}
+
+QUIZ_CASE(python_native_loops_call_vm_hook) {
+  micropython_port_vm_hook_statistics_t before = micropython_port_vm_hook_statistics();
+  assert_script_execution_succeeds(
+      "@micropython.viper\n"
+      "def count(n: int) -> int:\n"
+      "  i = 0\n"
+      "  while i < n:\n"
+      "    i += 1\n"
+      "  return i\n"
+      "count(10000)\n");
+  micropython_port_vm_hook_statistics_t after = micropython_port_vm_hook_statistics();
+  // The backward jumps of native loops call the hook, so they can be interrupted
+  quiz_assert(after.numberOfCalls - before.numberOfCalls >= 10000);
+}
+
+/* Run with --benchmark to compare the bytecode and native durations of typical
+ * numeric loops of student scripts. */
+
+static const char * s_mandelbrotScript =
+  "def mandelbrot(N):\n"
+  "  count = 0\n"
+  "  for x in range(64):\n"
+  "    for y in range(48):\n"
+  "      z = complex(0, 0)\n"
+  "      c = complex(3.5 * x / 64 - 2.5, -2.5 * y / 48 + 1.25)\n"
+  "      i = 0\n"
+  "      while i < N and abs(z) < 2:\n"
+  "        i += 1\n"
+  "        z = z * z + c\n"
+  "      count += i\n"
+  "  return count\n"
+  "print(mandelbrot(10))\n";
+
+static const char * s_primesScript =
+  "def number_of_primes(n):\n"
+  "  count = 0\n"
+  "  for k in range(2, n):\n"
+  "    d = 2\n"
+  "    while d * d <= k and k % d != 0:\n"
+  "      d += 1\n"
+  "    if d * d > k:\n"
+  "      count += 1\n"
+  "  return count\n"
+  "print(number_of_primes(5000))\n";
+
+static void assert_native_script_matches_bytecode(const char * script, const char * outputText) {
+  constexpr int bufferSize = 1024;
+  char nativeScript[bufferSize];
+  int length = strlcpy(nativeScript, "@micropython.native\n", bufferSize);
+  quiz_assert(strlcpy(nativeScript + length, script, bufferSize - length) < static_cast<size_t>(bufferSize - length));
+  assert_script_execution_succeeds(script, outputText);
+  assert_script_execution_succeeds(nativeScript, outputText);
+}
+
+QUIZ_CASE(python_native_benchmark_mandelbrot) {
+  assert_native_script_matches_bytecode(s_mandelbrotScript, "14514\n");
+}
+
+QUIZ_CASE(python_native_benchmark_primes) {
+  assert_native_script_matches_bytecode(s_primesScript, "669\n");
+}
+
+#endif
@@ -36,3 +36,22 @@ QUIZ_CASE(python_turtle_circle) {
   //assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_turtle_fast_mode) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "speed(0)");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  assert_command_execution_succeeds(env, "goto(30,-12)");
+  assert_command_execution_succeeds(env, "position()", "(30.0, -12.0)\n");
+  assert_command_execution_succeeds(env, "tracer(0)");
+  assert_command_execution_succeeds(env, "tracer()", "0\n");
+  assert_command_execution_succeeds(env, "circle(20)");
+  assert_command_execution_succeeds(env, "pensize(3)");
+  assert_command_execution_succeeds(env, "forward(40)");
+  assert_command_execution_succeeds(env, "tracer(4)");
+  assert_command_execution_succeeds(env, "for i in range(36):\n  forward(10)\n  left(170)\n");
+  assert_command_execution_succeeds(env, "reset()");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  deinit_environment();
+}
@@ -4,21 +4,140 @@
 #include <poincare/init.h>
 #include <poincare/tree_pool.h>
 #include <poincare/exception_checkpoint.h>
+#if ION_THREAD_LOCAL_SINGLETONS
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#endif
+
+#if ION_THREAD_LOCAL_SINGLETONS
+static std::mutex s_printMutex;
+#endif
 
 void quiz_print(const char * message) {
+#if ION_THREAD_LOCAL_SINGLETONS
+  std::lock_guard<std::mutex> lock(s_printMutex);
+#endif
   Ion::Console::writeLine(message);
 }
 
+#if ION_THREAD_LOCAL_SINGLETONS
+
+/* On host builds, the runner accepts the following options:
+ * --jobs N     Run the Poincare test cases on N worker threads, each with its
+ *              own tree pool, storage and preferences. The other test cases
+ *              rely on singletons shared by the whole process (the Python
+ *              heap, the apps...) and run afterwards on the main thread.
+ * --benchmark  Report the duration and the tree pool high-water mark of each
+ *              test case. */
+
+static int s_numberOfJobs = 1;
+static bool s_benchmark = false;
+
+static void parse_arguments(int argc, const char * const argv[]) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+      s_numberOfJobs = atoi(argv[++i]);
+      if (s_numberOfJobs <= 0) {
+        s_numberOfJobs = std::thread::hardware_concurrency();
+      }
+    } else if (strcmp(argv[i], "--benchmark") == 0) {
+      s_benchmark = true;
+    }
+  }
+}
+
+static bool runs_on_worker_threads(int caseIndex) {
+  return s_numberOfJobs > 1 && strncmp(quiz_case_files[caseIndex], "poincare/test/", strlen("poincare/test/")) == 0;
+}
+
+#endif
+
+static void run_case(int caseIndex) {
+  QuizCase c = quiz_cases[caseIndex];
+#if ION_THREAD_LOCAL_SINGLETONS
+  if (!s_benchmark) {
+    quiz_print(quiz_case_names[caseIndex]);
+  }
+#if POINCARE_TREE_POOL_STATISTICS
+  Poincare::TreePool::sharedPool()->resetHighWaterMark();
+#endif
+  uint64_t startTime = Ion::Timing::millis();
+#else
+  quiz_print(quiz_case_names[caseIndex]);
+#endif
+  int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
+  quiz_assert(initialPoolSize == 0);
+  c();
+  int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
+  quiz_assert(initialPoolSize == currentPoolSize);
+#if ION_THREAD_LOCAL_SINGLETONS
+  if (s_benchmark) {
+    char buffer[128];
+    int length = snprintf(buffer, sizeof(buffer), "%s time: %llums",
+        quiz_case_names[caseIndex],
+        static_cast<unsigned long long>(Ion::Timing::millis() - startTime));
+#if POINCARE_TREE_POOL_STATISTICS
+    if (length >= 0 && length < static_cast<int>(sizeof(buffer))) {
+      snprintf(buffer + length, sizeof(buffer) - length, " pool: %zu bytes", Poincare::TreePool::sharedPool()->highWaterMark());
+    }
+#else
+    (void)length;
+#endif
+    quiz_print(buffer);
+  }
+#endif
+}
+
+#if ION_THREAD_LOCAL_SINGLETONS
+
+static void run_cases_on_worker_thread(std::atomic<int> * nextCaseIndex) {
+  Poincare::Init(); // Initialize the thread's Poincare::TreePool::sharedPool
+  Poincare::ExceptionCheckpoint ecp;
+  if (ExceptionRun(ecp)) {
+    int numberOfCases = 0;
+    while (quiz_cases[numberOfCases] != NULL) {
+      numberOfCases++;
+    }
+    int i;
+    while ((i = (*nextCaseIndex)++) < numberOfCases) {
+      if (runs_on_worker_threads(i)) {
+        run_case(i);
+      }
+    }
+  } else {
+    quiz_assert(false);
+  }
+}
+
+#endif
+
 static inline void ion_main_inner() {
+#if ION_THREAD_LOCAL_SINGLETONS
+  if (s_numberOfJobs > 1) {
+    std::atomic<int> nextCaseIndex(0);
+    std::vector<std::thread> workers;
+    for (int j = 0; j < s_numberOfJobs; j++) {
+      workers.emplace_back(run_cases_on_worker_thread, &nextCaseIndex);
+    }
+    for (std::thread & worker : workers) {
+      worker.join();
+    }
+  }
+#endif
   int i = 0;
   while (quiz_cases[i] != NULL) {
-    QuizCase c = quiz_cases[i];
-    quiz_print(quiz_case_names[i]);
-    int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == 0);
-    c();
-    int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
-    quiz_assert(initialPoolSize == currentPoolSize);
+#if ION_THREAD_LOCAL_SINGLETONS
+    if (runs_on_worker_threads(i)) {
+      i++;
+      continue;
+    }
+#endif
+    run_case(i);
     i++;
   }
   quiz_print("ALL TESTS FINISHED");
@@ -41,6 +160,9 @@ void ion_main(int argc, const char * const argv[]) {
   volatile int stackTop;
   Ion::setStackStart((void *)(&stackTop));
 #endif
+#if ION_THREAD_LOCAL_SINGLETONS
+  parse_arguments(argc, argv);
+#endif
 
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
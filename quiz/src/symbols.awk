@@ -6,7 +6,7 @@ BEGIN {
 
 #FIXME: Is there a way to capture subexpression in awk? The following gsub is
 #       kind of ugly
-/QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 "," }
+/QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 ","; files = files "  \"" FILENAME "\",\n" }
 
 END {
   declarations = tests;
@@ -30,4 +30,9 @@ END {
   names = names "  NULL"
   print names;
   print "};"
+  print ""
+
+  print "char * quiz_case_files[] = {";
+  print files "  NULL";
+  print "};"
 }
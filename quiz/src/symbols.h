@@ -2,3 +2,4 @@ typedef void (*QuizCase)(void);
 
 extern QuizCase quiz_cases[];
 extern char * quiz_case_names[];
+extern char * quiz_case_files[];